@@ -93,6 +93,8 @@ void canvas_2d() {
     plot_2d_canvas.setFrame(
         osm::FrameStyle::BOX,
         osm::feat(osm::col, "bg white") + osm::feat(osm::col, "black"));
+    plot_2d_canvas.enableAxes(true);
+    plot_2d_canvas.setAxesFeat(osm::feat(osm::col, "black"));
     plot_2d_canvas.setScale(1 / 3.14, 0.2);
     for (float i = 0; i < 40; i++) {
         plot_2d_canvas.setOffset(i / 3.14, -2);
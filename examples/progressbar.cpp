@@ -252,6 +252,7 @@ void multi_bars() {
 
     auto job2 = [&bars, &prog_int_2]() {
         for (int32_t i = prog_int_2.getMin(); i < prog_int_2.getMax(); i++) {
+            if (i % 5 == 0) bars.log("Processed chunk " + std::to_string(i) + ".");
             bars.for_one(1, osm::updater{}, i);
             std::this_thread::sleep_for(std::chrono::milliseconds(200));
         }
@@ -272,6 +273,7 @@ void multi_bars() {
     first_job.join();
     second_job.join();
     third_job.join();
+    bars.flush_logs();
 
     osm::cout << "\n\n\n";
 }
@@ -20,10 +20,17 @@
 //     Headers
 //====================================================
 
+// My headers
+#include <osmanip/graphics/image.hpp>
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/frame_pacer.hpp>
+#include <osmanip/utility/thread_pool.hpp>
+
 // STD headers
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace osm {
@@ -52,8 +59,9 @@ namespace osm {
     class Canvas {
         public:
 
-            // Constructors
+            // Constructors and destructor
             explicit Canvas(uint32_t width, uint32_t height);
+            virtual ~Canvas() = default;
 
             // Setters
             void enableFrame(bool frame_enabled);
@@ -61,6 +69,9 @@ namespace osm {
             void setBackground(char c, std::string_view feat = "");
             void setWidth(uint32_t width);
             void setHeight(uint32_t height);
+            void setFramePacer(FramePacer *pacer);
+            void enableAutoResize(bool auto_resize);
+            void setThreadPool(ThreadPool *pool);
 
             // Getters
             char getBackground() const;
@@ -70,14 +81,45 @@ namespace osm {
             FrameStyle getFrameStyle() const;
             uint32_t getWidth() const;
             uint32_t getHeight() const;
+            FramePacer *getFramePacer() const;
+            bool isAutoResizeEnabled() const;
+            ThreadPool *getThreadPool() const;
+            char getChar(uint32_t x, uint32_t y) const;
+            std::string getFeat(uint32_t x, uint32_t y) const;
+            std::string getGlyph(uint32_t x, uint32_t y) const;
 
             // Methods
             void clear();
+            void resize(uint32_t width, uint32_t height);
             void put(uint32_t x, uint32_t y, char c, std::string_view feat = "");
+            void putUnchecked(uint32_t x, uint32_t y, char c, std::string_view feat = "");
+            void putGlyph(uint32_t x, uint32_t y, std::string_view glyph, std::string_view feat = "",
+                          char fallback = ' ');
+            void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, char c, std::string_view feat = "");
+            void drawHLine(int32_t x, int32_t y, int32_t length, char c, std::string_view feat = "");
+            void drawVLine(int32_t x, int32_t y, int32_t length, char c, std::string_view feat = "");
+            void drawText(int32_t x, int32_t y, std::string_view text, std::string_view feat = "");
+            void blit(const Canvas &src, int32_t x, int32_t y);
+            void shift(int32_t dx, int32_t dy);
+            void drawImage(const Image &image, int32_t x, int32_t y, uint32_t cols, uint32_t rows,
+                           ColorMode mode = TRUECOLOR, bool dither = false);
+            void addLayer(const Canvas &layer, int32_t z);
+            void removeLayer(const Canvas &layer);
+            void invalidateLayers();
             void refresh();
+            void render(FrameAssembler &frame) const;
 
         private:
 
+            // Structs
+            struct Layer {
+                    const Canvas *canvas;
+                    int32_t z;
+            };
+            struct CachedCell {
+                    uint32_t offset, size;
+            };
+
             // Members
             bool frame_enabled_;
             FrameStyle frame_style_;
@@ -85,19 +127,59 @@ namespace osm {
             char bg_char_;
             std::string bg_feat_;
             std::vector<char> char_buffer_;
-            std::vector<std::string> feat_buffer_;
-            bool already_drawn_;
+            std::vector<uint32_t> feat_buffer_;
+            std::vector<uint8_t> glyph_buffer_;
+
+            // Table of the feats of the cells, which store their ids
+            std::vector<std::string> feats_;
+            std::unordered_map<std::string, uint32_t> feat_ids_;
+            std::string feat_key_;
+            uint32_t bg_feat_id_, last_feat_id_;
+            size_t feats_limit_;
+            std::vector<uint32_t> feat_map_;
+            uint32_t stride_;
+            uint32_t drawn_height_;
+            bool resized_;
+            bool auto_resize_;
+            uint64_t resize_count_;
+            FramePacer *pacer_;
+            FrameAssembler frame_;
+            ThreadPool *pool_;
+            mutable std::vector<FrameAssembler> chunks_;
+            uint64_t version_;
+            std::vector<Layer> layers_;
+
+            // Cache of the static layers
+            mutable bool cache_valid_;
+            mutable bool cache_plain_;
+            mutable std::vector<uint64_t> cache_versions_;
+            mutable std::string cache_pool_;
+            mutable std::vector<CachedCell> cache_above_, cache_below_;
+            mutable std::string frame_top_, frame_bottom_, frame_left_, frame_right_;
 
             // Constants
             static const std::vector<std::vector<std::string>> frames;
 
             // Methods
-            void resizeCanvas();
+            size_t index(uint32_t x, uint32_t y) const;
+            size_t checkedIndex(uint32_t x, uint32_t y) const;
+            bool clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h) const;
+            void autoResize();
+            void updateCache(bool plain) const;
+            void renderRows(FrameAssembler &frame, uint32_t first, uint32_t last, bool plain) const;
+            uint32_t intern(std::string_view feat);
+            void collectFeats();
+            bool isTransparent(size_t p) const;
+            std::string_view glyphOf(size_t p) const;
+            std::string_view featOf(size_t p) const;
 
         protected:
 
             // Members
             uint32_t width_, height_;
+
+            // Methods
+            virtual void updateLayers();
     };
 }  // namespace osm
 
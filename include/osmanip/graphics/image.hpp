@@ -0,0 +1,82 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file image.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_GRAPHICS_IMAGE_HPP
+#define OSMANIP_GRAPHICS_IMAGE_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     ColorMode
+    //====================================================
+    /**
+     * @brief Enum class used to define the colors used to draw images: 24-bit colors, the 240 colors of the xterm
+     * cube and grayscale ramp, or the 16 standard colors.
+     */
+    typedef enum { TRUECOLOR = 0, COLOR256 = 1, COLOR16 = 2 } ColorMode;
+
+    //====================================================
+    //     Image class
+    //====================================================
+    /**
+     * @brief This class is used to store an RGB bitmap (3 bytes per pixel, row by row, without padding), which can
+     * then be drawn into a canvas.
+     *
+     */
+    class Image {
+        public:
+
+            // Constructors
+            explicit Image(uint32_t width = 0, uint32_t height = 0, const uint8_t *rgb = nullptr);
+
+            // Getters
+            uint32_t getWidth() const;
+            uint32_t getHeight() const;
+            const uint8_t *getPixel(uint32_t x, uint32_t y) const;
+            const uint8_t *data() const;
+            uint8_t *data();
+
+            // Methods
+            Image resized(uint32_t width, uint32_t height) const;
+            static Image loadPPM(std::istream &is);
+
+        private:
+
+            // Members
+            uint32_t width_, height_;
+            std::vector<uint8_t> pixels_;
+    };
+
+    //====================================================
+    //     Functions
+    //====================================================
+    extern std::array<int32_t, 3> palette_rgb(uint32_t index);
+    extern uint8_t nearest_color(uint8_t r, uint8_t g, uint8_t b, ColorMode mode);
+    extern int32_t dither_bias(uint32_t x, uint32_t y, ColorMode mode);
+    extern void append_color(std::string &out, const uint8_t *rgb, bool background, ColorMode mode, int32_t bias = 0);
+}  // namespace osm
+
+#endif
@@ -27,9 +27,20 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace osm {
 
+    //====================================================
+    //     DensityStyle
+    //====================================================
+    /**
+     * @brief Enum used to define how a density scatter plot is drawn: with a char palette going from sparse to dense
+     * cells, or with Braille dots (2x4 dots per cell).
+     */
+    typedef enum { PALETTE = 0, BRAILLE = 1 } DensityStyle;
+
     //====================================================
     //     Plot2DCanvas
     //====================================================
@@ -49,16 +60,53 @@ namespace osm {
 
             // Constructors
             explicit Plot2DCanvas(uint32_t w, uint32_t h);
+            Plot2DCanvas(const Plot2DCanvas &other);
+            Plot2DCanvas &operator=(const Plot2DCanvas &other);
 
             // Setters
             void setOffset(float xOff, float yOff);
             void setScale(float xScale, float yScale);
+            void enableAxes(bool axes_enabled);
+            void setAxesFeat(std::string_view feat);
+            void enableAutoScale(bool auto_scale);
+            void setSamplingBudget(size_t budget);
 
             // Getters
             float getOffsetX() const;
             float getOffsetY() const;
             float getScaleX() const;
             float getScaleY() const;
+            bool isAxesEnabled() const;
+            std::string getAxesFeat() const;
+            const Canvas &getAxes() const;
+            bool isAutoScaleEnabled() const;
+            size_t getSeries() const;
+            size_t getPoints(size_t series) const;
+            float getMinX() const;
+            float getMaxX() const;
+            float getMinY() const;
+            float getMaxY() const;
+            size_t getSamplingBudget() const;
+            size_t getFunctions() const;
+
+            // Methods
+            void updateAxes();
+            size_t addSeries(char c, std::string_view feat = "");
+            void addPoint(size_t series, float x, float y);
+            void addPoints(size_t series, const std::vector<float> &xs, const std::vector<float> &ys);
+            void clearSeries();
+            void autoScale();
+            void drawSeries();
+            void drawDensity(const std::vector<float> &xs, const std::vector<float> &ys,
+                             DensityStyle style = DensityStyle::PALETTE, std::string_view feat = "");
+            size_t drawAdaptive(const std::function<double(double)> &function, char c, std::string_view feat = "");
+            size_t addFunction(const std::function<double(double)> &function, char c, std::string_view feat = "",
+                               bool parallel = false);
+            void clearFunctions();
+            void invalidateSamples();
+            size_t drawFunctions();
+            void drawParallel(const std::function<double(double)> &function, char c, std::string_view feat = "");
+            void pan(int32_t columns, int32_t rows = 0);
 
             // Draw
             /**
@@ -88,11 +136,61 @@ namespace osm {
                 }
             }
 
+        protected:
+
+            // Methods
+            void updateLayers() override;
+
         private:
 
+            // Structs
+            struct AxesLayout {
+                    float offset_x, offset_y, scale_x, scale_y;
+                    uint32_t width, height;
+                    bool frame_enabled;
+                    std::string bg_feat;
+            };
+            struct Series {
+                    char c;
+                    std::string feat;
+                    std::vector<float> xs, ys;
+            };
+            struct Function {
+                    std::function<double(double)> function;
+                    char c;
+                    std::string feat;
+                    bool parallel;
+                    double first, step;
+                    std::vector<double> ys;
+            };
+
             // Members
             float offset_x_, offset_y_, scale_x_, scale_y_;
+            bool axes_enabled_;
+            std::string axes_feat_;
+            Canvas axes_;
+            AxesLayout axes_layout_;
+            bool axes_valid_;
+            std::vector<Series> series_;
+            bool auto_scale_;
+            float min_x_, max_x_, min_y_, max_y_;
+            std::vector<std::vector<uint32_t>> bins_;
+            size_t sampling_budget_;
+            std::vector<Function> functions_;
+            std::vector<double> samples_;
+            std::vector<size_t> pending_;
+
+            // Methods
+            void extendBounds(float x, float y);
+            void evaluate(const std::function<double(double)> &function, double first, double step, bool parallel);
+            void rasterize(char c, std::string_view feat);
     };
+
+    //====================================================
+    //     Functions
+    //====================================================
+    extern double nice_number(double x, bool round);
+    extern std::string format_tick(double value, double step);
 }  // namespace osm
 
 #endif
\ No newline at end of file
@@ -0,0 +1,112 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file table.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_GRAPHICS_TABLE_HPP
+#define OSMANIP_GRAPHICS_TABLE_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/iostream.hpp>
+
+// STD headers
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     Table
+    //====================================================
+    /**
+     * @brief This class prints a table with aligned columns, optionally colored or styled (e.g. with
+     * feat(col, "red")). The width of a column is fixed (setWidth) or computed from the display width of its cells
+     * (see display_width), which may contain colors and wide chars. The rows are buffered until all the widths are
+     * known: at the end of the table (finish) by default, after the first rows if a number of sample rows is set, or
+     * never if all the widths are fixed. From then on each row is formatted straight into the output buffer, so a
+     * table of any length is printed with constant memory. Cells wider than their column are truncated with "…".
+     *
+     */
+    class Table {
+        public:
+
+            // Constructors and destructor
+            explicit Table(std::ostream &out = osm::cout, size_t sample_rows = 0);
+            Table(const Table &) = delete;
+            Table &operator=(const Table &) = delete;
+            ~Table();
+
+            // Setters
+            void setHeader(const std::vector<std::string> &header);
+            void setWidth(size_t column, size_t width);
+            void setAlignment(size_t column, std::string_view alignment);
+            void setFeat(size_t column, std::string_view feat);
+            void setHeaderFeat(std::string_view feat);
+            void setSeparator(std::string_view separator);
+            void setSampleRows(size_t sample_rows);
+
+            // Getters
+            size_t getColumns() const;
+            std::vector<size_t> getWidths() const;
+            uint64_t getRows() const;
+            size_t getSampleRows() const;
+            bool isStreaming() const;
+
+            // Methods
+            void addRow(std::initializer_list<std::string_view> cells);
+            void addRow(const std::vector<std::string> &cells);
+            void addRow(const std::string_view *cells, size_t count);
+            void finish();
+
+        private:
+
+            // Structs
+            struct Column {
+                    size_t width;
+                    bool fixed;
+                    char alignment;
+                    std::string feat;
+            };
+
+            // Members
+            std::ostream &out_;
+            size_t sample_rows_;
+            bool streaming_;
+            uint64_t rows_;
+            std::vector<Column> columns_;
+            std::vector<std::string> header_;
+            std::string header_feat_, separator_, buffer_;
+            std::string pending_cells_;
+            std::vector<size_t> pending_ends_, pending_counts_;
+
+            // Methods
+            Column &column(size_t index);
+            void checkNotStreaming() const;
+            void start();
+            void appendRow(const std::string_view *cells, size_t count, bool header);
+            void appendCell(std::string_view cell, const Column &column, const std::string &prefix, bool last);
+            void appendRule();
+            void flushBuffer(bool force);
+    };
+}  // namespace osm
+
+#endif
@@ -48,6 +48,40 @@ namespace osm {
     //====================================================
     extern const std::string feat(const string_pair_map &generic_map, const std::string &feat_string, int32_t feat_int);
     extern const std::string go_to(int32_t x, int32_t y);
+    extern std::string move_by(int32_t rows, int32_t cols);
+
+    //====================================================
+    //     CursorPlanner
+    //====================================================
+    /**
+     * @brief Class used to keep track of the cursor position and to move it with the shortest possible sequence of
+     * bytes. For each move the absolute, relative, carriage return, backspace and newline encodings are compared and
+     * the cheapest one is chosen. Positions are 1-based, as in go_to.
+     *
+     */
+    class CursorPlanner {
+        public:
+
+            // Constructors
+            explicit CursorPlanner(int32_t row = 1, int32_t col = 1);
+
+            // Setters
+            void setPosition(int32_t row, int32_t col);
+
+            // Getters
+            int32_t getRow() const;
+            int32_t getCol() const;
+
+            // Methods
+            std::string moveTo(int32_t row, int32_t col);
+            std::string moveBy(int32_t rows, int32_t cols);
+            void advance(int32_t cols);
+
+        private:
+
+            // Members
+            int32_t row_, col_;
+    };
 }  // namespace osm
 
 #endif
\ No newline at end of file
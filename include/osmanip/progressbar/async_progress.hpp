@@ -0,0 +1,224 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file async_progress.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_PROGRESSBAR_ASYNCPROGRESS_HPP
+#define OSMANIP_PROGRESSBAR_ASYNCPROGRESS_HPP
+
+// The header is empty unless it is compiled as C++20 with coroutines and atomic waits
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine) && defined(__cpp_lib_atomic_wait)
+#define OSMANIP_PROGRESSBAR_ASYNCPROGRESS_AVAILABLE
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/progressbar/completion_tracker.hpp>
+#include <osmanip/progressbar/progress_bar.hpp>
+
+// STD headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <thread>
+
+namespace osm {
+
+    //====================================================
+    //     AsyncProgress
+    //====================================================
+    /**
+     * @brief This class is a progress handle for coroutines (C++20 only): a coroutine reports its progress with
+     * co_await progress.step(n), which never suspends and only adds to an atomic counter, so the executor thread never
+     * waits on the ProgressBar mutex or on the terminal. A drawer thread sleeps on the counter and redraws the bar at
+     * most once per interval, coalescing all the steps in between. If osmanip is built in single-threaded mode there
+     * is no drawer thread and step redraws the bar itself, at most once per interval.
+     *
+     * @tparam bar_type The type of the ProgressBar, whose range (max - min) is mapped to the total number of steps.
+     */
+    template <typename bar_type>
+    class AsyncProgress {
+        public:
+
+            //====================================================
+            //     Step
+            //====================================================
+            /**
+             * @brief Awaitable returned by step. It is always ready and resumes with the number of steps completed so
+             * far.
+             *
+             */
+            class Step {
+                public:
+
+                    bool await_ready() const noexcept { return true; }
+                    void await_suspend(std::coroutine_handle<>) const noexcept {}
+                    uint64_t await_resume() const noexcept { return completed_; }
+
+                private:
+
+                    friend class AsyncProgress;
+                    explicit Step(uint64_t completed) : completed_(completed) {}
+
+                    uint64_t completed_;
+            };
+
+            //====================================================
+            //     Constructors and destructor
+            //====================================================
+
+            // Parametric constructor
+            /**
+             * @brief Construct a new AsyncProgress object and start its drawer.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param bar The ProgressBar, which must outlive the handle.
+             * @param total The total number of steps.
+             * @param interval The minimum time between two redraws.
+             */
+            AsyncProgress(ProgressBar<bar_type> &bar, uint64_t total,
+                          std::chrono::milliseconds interval = std::chrono::milliseconds(33))
+                : bar_(bar), total_(total), interval_(interval), completed_(0), last_draw_() {
+#ifndef OSMANIP_SINGLE_THREADED
+                drawer_ = std::thread(&AsyncProgress::draw, this);
+#endif
+            }
+
+            AsyncProgress(const AsyncProgress &) = delete;
+            AsyncProgress &operator=(const AsyncProgress &) = delete;
+
+            // Destructor
+            /**
+             * @brief Destroy the AsyncProgress object, drawing the final state of the bar.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             */
+            ~AsyncProgress() { finish(); }
+
+            //====================================================
+            //     Getters
+            //====================================================
+
+            // getTotal
+            /**
+             * @brief Get the total number of steps.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return uint64_t The total number of steps.
+             */
+            uint64_t getTotal() const { return total_; }
+
+            // getCompleted
+            /**
+             * @brief Get the number of steps completed so far.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return uint64_t The number of completed steps.
+             */
+            uint64_t getCompleted() const { return completed_.load(std::memory_order_relaxed) & ~finished_flag; }
+
+            //====================================================
+            //     Methods
+            //====================================================
+
+            // step
+            /**
+             * @brief Add completed steps, to be used as co_await progress.step(n). It can be called from any thread.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param n The number of completed steps.
+             * @return Step The awaitable, which resumes with the number of steps completed so far.
+             */
+            Step step(uint64_t n = 1) {
+                const uint64_t completed = (completed_.fetch_add(n, std::memory_order_release) + n) & ~finished_flag;
+
+#ifdef OSMANIP_SINGLE_THREADED
+                const auto now = steady_clock::now();
+                if (now - last_draw_ >= interval_) {
+                    last_draw_ = now;
+                    CompletionTracker::update(bar_, std::min(completed, total_), total_);
+                }
+#else
+                completed_.notify_one();
+#endif
+                return Step(completed);
+            }
+
+            // finish
+            /**
+             * @brief Stop the drawer and draw the final state of the bar. Steps added later are counted but not drawn.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             */
+            void finish() {
+                if (completed_.fetch_or(finished_flag) & finished_flag) return;
+
+#ifdef OSMANIP_SINGLE_THREADED
+                CompletionTracker::update(bar_, std::min(getCompleted(), total_), total_);
+#else
+                completed_.notify_one();
+                drawer_.join();
+#endif
+            }
+
+        private:
+
+            //====================================================
+            //     Private methods
+            //====================================================
+
+            // draw
+            /**
+             * @brief Loop of the drawer thread: sleep until the counter changes, redraw the bar and wait for the
+             * interval, so that all the steps in between are drawn at once, until the handle is finished.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             */
+            void draw() {
+                uint64_t drawn = 0;
+                while (true) {
+                    completed_.wait(drawn, std::memory_order_acquire);
+                    drawn = completed_.load(std::memory_order_acquire);
+
+                    CompletionTracker::update(bar_, std::min(drawn & ~finished_flag, total_), total_);
+                    if (drawn & finished_flag) return;
+                    std::this_thread::sleep_for(interval_);
+                }
+            }
+
+            //====================================================
+            //     Private attributes
+            //====================================================
+
+            // Highest bit of the counter, set by finish to wake the drawer for the last time
+            static constexpr uint64_t finished_flag = uint64_t{1} << 63;
+
+            ProgressBar<bar_type> &bar_;
+            const uint64_t total_;
+            const std::chrono::milliseconds interval_;
+            std::atomic<uint64_t> completed_;
+            steady_clock::time_point last_draw_;
+            std::thread drawer_;
+    };
+}  // namespace osm
+
+#endif
+
+#endif
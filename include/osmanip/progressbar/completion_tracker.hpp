@@ -0,0 +1,223 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file completion_tracker.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_PROGRESSBAR_COMPLETIONTRACKER_HPP
+#define OSMANIP_PROGRESSBAR_COMPLETIONTRACKER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/utility/generic.hpp>
+
+// STD headers
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     CompletionTracker
+    //====================================================
+    /**
+     * @brief This class drives a progress report (e.g. a ProgressBar or a make_MultiProgressBar) from the completion of
+     * asynchronous tasks, without polling: the tasks (e.g. run by a ThreadPool) call complete when they finish, which
+     * only increments an atomic counter and wakes the waiter, while the waiter thread sleeps on a condition variable
+     * and reports the completions in batches, once per wake-up. Futures can be tracked with waitFutures.
+     *
+     */
+    class CompletionTracker {
+        public:
+
+            //====================================================
+            //     Aliases
+            //====================================================
+            using callback_type = std::function<void(size_t)>;
+
+            //====================================================
+            //     Constructors
+            //====================================================
+
+            // Parametric constructor
+            /**
+             * @brief Construct a new CompletionTracker object.
+             *
+             * @param total The number of tasks to be tracked.
+             */
+            explicit CompletionTracker(size_t total) : total_(total), completed_(0) {}
+
+            CompletionTracker(const CompletionTracker &) = delete;
+            CompletionTracker &operator=(const CompletionTracker &) = delete;
+
+            //====================================================
+            //     Getters
+            //====================================================
+
+            // getTotal
+            /**
+             * @brief Get the number of tasks to be tracked.
+             *
+             * @return size_t The number of tasks.
+             */
+            size_t getTotal() const { return total_; }
+
+            // getCompleted
+            /**
+             * @brief Get the number of completed tasks.
+             *
+             * @return size_t The number of completed tasks.
+             */
+            size_t getCompleted() const { return completed_.load(std::memory_order_acquire); }
+
+            //====================================================
+            //     Methods
+            //====================================================
+
+            // complete
+            /**
+             * @brief Mark tasks as completed. It can be called from any thread, e.g. at the end of each task.
+             *
+             * @param count The number of completed tasks.
+             */
+            void complete(size_t count = 1) {
+                completed_.fetch_add(count, std::memory_order_acq_rel);
+
+                // The empty critical section orders the increment with the check of a waiter about to sleep
+                { std::lock_guard<std::mutex> lock{mutex_}; }
+                wake_.notify_one();
+            }
+
+            // wait (first overload)
+            /**
+             * @brief Wait until all the tasks are completed, calling a function with the number of completed tasks
+             * after each batch of completions. Completions happening while the function runs are reported by the next
+             * call, so a slow report doesn't slow down the tasks.
+             *
+             * @param on_progress The function called with the number of completed tasks.
+             */
+            void wait(const callback_type &on_progress) {
+                size_t reported = 0;
+                while (reported < total_) {
+                    std::unique_lock<std::mutex> lock{mutex_};
+                    wake_.wait(lock, [&] { return getCompleted() != reported; });
+                    reported = getCompleted();
+                    lock.unlock();
+
+                    on_progress(reported);
+                }
+            }
+
+            // wait (second overload)
+            /**
+             * @brief Wait until all the tasks are completed, updating a ProgressBar after each batch of completions.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param bar The ProgressBar, whose range (max - min) is mapped to the number of tasks.
+             */
+            template <typename bar_type>
+            void wait(ProgressBar<bar_type> &bar) {
+                wait([this, &bar](size_t completed) { update(bar, completed, total_); });
+            }
+
+            // waitFutures (first overload)
+            /**
+             * @brief Wait until all the futures (std::future or std::shared_future) are ready, calling a function with
+             * the number of ready futures when it changes. The thread sleeps on the first future which is not ready,
+             * waking up at least once per interval to count the others, which may complete out of order.
+             *
+             * @tparam future_type The type of the futures.
+             * @param futures The futures, which must be valid. Their results are not retrieved.
+             * @param on_progress The function called with the number of ready futures.
+             * @param interval The maximum time between two counts.
+             */
+            template <typename future_type>
+            static void waitFutures(std::vector<future_type> &futures, const callback_type &on_progress,
+                                    std::chrono::milliseconds interval = std::chrono::milliseconds(100)) {
+                std::vector<bool> ready(futures.size(), false);
+                size_t completed = 0, first = 0;
+
+                while (completed < futures.size()) {
+                    while (ready[first]) first++;
+                    futures[first].wait_for(interval);
+
+                    const size_t previous = completed;
+                    for (size_t i = first; i < futures.size(); i++) {
+                        if (ready[i] || futures[i].wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                            continue;
+                        }
+                        ready[i] = true;
+                        completed++;
+                    }
+                    if (completed != previous) on_progress(completed);
+                }
+            }
+
+            // waitFutures (second overload)
+            /**
+             * @brief Wait until all the futures (std::future or std::shared_future) are ready, updating a ProgressBar
+             * when the number of ready futures changes.
+             *
+             * @tparam future_type The type of the futures.
+             * @tparam bar_type The type of the ProgressBar.
+             * @param futures The futures, which must be valid. Their results are not retrieved.
+             * @param bar The ProgressBar, whose range (max - min) is mapped to the number of futures.
+             */
+            template <typename future_type, typename bar_type>
+            static void waitFutures(std::vector<future_type> &futures, ProgressBar<bar_type> &bar) {
+                const size_t total = futures.size();
+                waitFutures(futures, [&bar, total](size_t completed) { update(bar, completed, total); });
+            }
+
+            // update
+            /**
+             * @brief Update a ProgressBar with the number of completed tasks, as if update was called by a loop over
+             * its range. Nothing is drawn while no task is completed.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param bar The ProgressBar.
+             * @param completed The number of completed tasks.
+             * @param total The number of tasks.
+             */
+            template <typename bar_type>
+            static void update(ProgressBar<bar_type> &bar, size_t completed, size_t total) {
+                if (completed == 0 || total == 0) return;
+
+                const double range = static_cast<double>(bar.getMax() - bar.getMin());
+                const double value = range * static_cast<double>(completed) / static_cast<double>(total);
+                bar.update(static_cast<bar_type>(static_cast<double>(bar.getMin()) + value -
+                                                 static_cast<double>(osm::one(bar.getMin()))));
+            }
+
+        private:
+
+            //====================================================
+            //     Private attributes
+            //====================================================
+            const size_t total_;
+            std::atomic<size_t> completed_;
+            std::mutex mutex_;
+            std::condition_variable wake_;
+    };
+}  // namespace osm
+
+#endif
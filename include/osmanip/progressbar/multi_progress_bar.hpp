@@ -24,15 +24,18 @@
 // My headers
 #include <osmanip/manipulators/cursor.hpp>
 #include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/locking.hpp>
 
 // STD headers
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace osm {
 
@@ -132,8 +135,67 @@ namespace osm {
                 call_all(gen_indices<sizeof...(Indicators)>(), std::forward<Func>(func), std::forward<Args>(args)...);
             }
 
+            // log
+            /**
+             * @brief Queue a line of text to be printed above the progress bars. Queued lines are not written
+             * immediately: they are emitted in a single batch on the next bar update (or flush_logs call), followed by a
+             * single redraw of the bars, so heavy logging costs one redraw per frame and not one per line.
+             *
+             * @param line The line to be printed. A trailing newline, if any, is ignored.
+             */
+            void log(std::string_view line) {
+                if (!line.empty() && line.back() == '\n') line.remove_suffix(1);
+
+                std::lock_guard<mutex_type> lock{log_mutex_};
+                log_queue_.emplace_back(line);
+            }
+
+            // flush_logs
+            /**
+             * @brief Print all the queued log lines above the progress bars and redraw the bars below them. Useful to
+             * empty the queue once the bars stopped being updated.
+             *
+             */
+            void flush_logs() {
+                std::lock_guard<mutex_type> lock{mutex_};
+                draw_logs(gen_indices<sizeof...(Indicators)>());
+            }
+
         private:
 
+            // draw_logs
+            /**
+             * @brief Method used to print the queued log lines above the progress bars. The cursor is moved on the
+             * first bar, the bars are cleared, the log lines are printed and then the bars are redrawn below them. The
+             * caller must own mutex_.
+             *
+             * @tparam Ids Variadic template parameter representing the indices of the progress bars to redraw.
+             *
+             * @param indices An instance of the "indices" template used to expand the variadic template parameter Ids.
+             */
+            template <size_t... Ids>
+            void draw_logs(indices<Ids...>) {
+                std::vector<std::string> lines;
+                {
+                    std::lock_guard<mutex_type> lock{log_mutex_};
+                    if (log_queue_.empty()) return;
+                    lines.swap(log_queue_);
+                }
+
+                std::string frame;
+                if (last_updated_index > 0) frame += feat(crs, "up", last_updated_index);
+                frame += feat(tcs, "crt") + feat(tcsc, "csc", 0);
+                for (const auto &line: lines) {
+                    frame += line;
+                    frame += '\n';
+                }
+                osm::cout << frame;
+
+                auto dummy = {(std::get<Ids>(bars_).redraw(), osm::cout << (Ids + 1 < size() ? "\n" : ""), 0)...};
+                (void)dummy;
+                last_updated_index = size() - 1;
+            }
+
             // call_one
             /**
              * @brief Method used to call only one progress bar for update.
@@ -149,19 +211,12 @@ namespace osm {
              */
             template <size_t... Ids, class Func, class... Args>
             void call_one(size_t idx, indices<Ids...>, Func func, Args &&...args) {
-                std::lock_guard<std::mutex> lock{mutex_};
+                std::lock_guard<mutex_type> lock{mutex_};
+                draw_logs(indices<Ids...>());
+
                 int32_t idx_delta = idx - last_updated_index;
-                std::string direction;
 
-                if (idx_delta < 0) {
-                    direction = "up";
-                    idx_delta = -idx_delta;
-                } else {
-                    direction = "down";
-                }
-                for (int32_t i = 0; i < idx_delta; i++) {
-                    osm::cout << feat(crs, direction, 1);
-                }
+                osm::cout << move_by(idx_delta, 0);
                 last_updated_index = idx;
                 [](...) {}
 
@@ -183,15 +238,19 @@ namespace osm {
              */
             template <size_t... Ids, class Func, class... Args>
             void call_all(indices<Ids...>, Func func, Args &&...args) {
-                std::lock_guard<std::mutex> lock{mutex_};
+                std::lock_guard<mutex_type> lock{mutex_};
+                draw_logs(indices<Ids...>());
+
                 auto dummy = {(func(std::get<Ids>(bars_), args...), 0)...};
                 (void)dummy;
             }
 
             // Attributes
             std::tuple<Indicators &...> bars_;
-            std::mutex mutex_;
+            mutex_type mutex_;
             uint32_t last_updated_index;
+            std::vector<std::string> log_queue_;
+            mutex_type log_mutex_;
     };
 
     //====================================================
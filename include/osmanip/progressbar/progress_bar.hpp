@@ -25,8 +25,12 @@
 #include <osmanip/manipulators/colsty.hpp>
 #include <osmanip/manipulators/common.hpp>
 #include <osmanip/manipulators/cursor.hpp>
+#include <osmanip/progressbar/sparkline.hpp>
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/frame_pacer.hpp>
 #include <osmanip/utility/generic.hpp>
 #include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/locking.hpp>
 
 // STD headers
 #include <stdint.h>
@@ -88,7 +92,8 @@ namespace osm {
                   color_(feat(rst, "color")),
                   color_name_(""),
                   ticks_occurred(0),
-                  time_flag_("off") {}
+                  time_flag_("off"),
+                  pacer_(nullptr) {}
 
             // Parametric constructor
             /**
@@ -113,7 +118,8 @@ namespace osm {
                   color_(feat(rst, "color")),
                   color_name_(""),
                   ticks_occurred(0),
-                  time_flag_("off") {}
+                  time_flag_("off"),
+                  pacer_(nullptr) {}
 
             //====================================================
             //     Setters
@@ -274,6 +280,35 @@ namespace osm {
              */
             void setRemainingTimeFlag(std::string_view time_flag) { time_flag_ = time_flag; }
 
+            // setFramePacer
+            /**
+             * @brief Set the FramePacer used to adapt the refresh rate to the speed of the output channel. Updates
+             * arriving before the pacer is ready are not printed (the bar state is still updated), except the last
+             * one of the loop (max - 1, or max - 0.1 for floating-point types), so that the bar always ends at 100%.
+             * Set to nullptr (default) to print every update.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param pacer The FramePacer, which must outlive the ProgressBar.
+             */
+            void setFramePacer(FramePacer *pacer) { pacer_ = pacer; }
+
+            // setSparkline
+            /**
+             * @brief Set the sparkline of the progress rate, drawn after the bar. The rate is sampled when the bar is
+             * drawn, at most once per interval, so update does no extra work between two samples. An interval without
+             * any drawing is a stall, so with a FramePacer the interval should be longer than its frame interval.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param width The number of samples (and glyphs) of the sparkline, 0 (default) to disable it.
+             * @param interval The minimum time between two samples.
+             * @throws std::runtime_error if the width is higher than Sparkline::max_width.
+             */
+            void setSparkline(size_t width, std::chrono::milliseconds interval = std::chrono::milliseconds(250)) {
+                sparkline_.setWidth(width);
+                sparkline_.setInterval(interval);
+                sparkline_.draw(sparkline_line_);
+            }
+
             //====================================================
             //     Resetters
             //====================================================
@@ -290,6 +325,8 @@ namespace osm {
                 brackets_open_ = "", brackets_close_ = "", color_ = feat(rst, "color");
                 color_name_ = "";
                 time_flag_ = "off";
+                line_.clear();
+                sparkline_.setWidth(0);
             }
 
             // resetMax
@@ -365,6 +402,17 @@ namespace osm {
                 color_name_ = "";
             }
 
+            // resetSparkline
+            /**
+             * @brief Clear the history of the ProgressBar sparkline, e.g. before running the loop again.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             */
+            void resetSparkline() {
+                sparkline_.reset();
+                sparkline_.draw(sparkline_line_);
+            }
+
             //====================================================
             //     Getters
             //====================================================
@@ -491,6 +539,24 @@ namespace osm {
              */
             std::string getRemainingTimeFlag() const { return time_flag_; }
 
+            // getFramePacer
+            /**
+             * @brief Get the FramePacer of the ProgressBar.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return The FramePacer of the ProgressBar, nullptr if not set.
+             */
+            FramePacer *getFramePacer() const { return pacer_; }
+
+            // getSparkline
+            /**
+             * @brief Get the sparkline of the ProgressBar.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return The sparkline of the ProgressBar, with width 0 if disabled.
+             */
+            const Sparkline &getSparkline() const { return sparkline_; }
+
             //====================================================
             //     Other methods
             //====================================================
@@ -503,7 +569,7 @@ namespace osm {
              * @param value The value of the progress bar indicator.
              */
             void update(bar_type iterating_var) {
-                std::lock_guard<std::mutex> lock{mutex_};
+                std::lock_guard<mutex_type> lock{mutex_};
 
                 iterating_var_ = 100 * (iterating_var - min_) / (max_ - min_ - osm::one(iterating_var)),
                 iterating_var_spin_ =
@@ -512,45 +578,45 @@ namespace osm {
 
                 // Update of the progress indicator only:
                 if (styles_map_.at("indicator").find(style_) != styles_map_.at("indicator").end()) {
-                    output_ = feat(crs, "left", 100) + getColor() +
+                    output_ = feat(tcs, "crt") + getColor() +
                               std::to_string(static_cast<int32_t>(round(iterating_var_++))) + feat(rst, "color") +
                               getStyle();
 
-                    update_output(output_);
+                    update_output(output_, iterating_var);
                 }
 
                 // Update of the loader indicator only:
                 else if (styles_map_.at("loader").find(style_) != styles_map_.at("loader").end()) {
                     output_ =
-                        feat(crs, "left", 100) + getBrackets_open() + getColor() + getStyle() * width_ +
+                        feat(tcs, "crt") + getBrackets_open() + getColor() + getStyle() * width_ +
                         osm::empty_space<std::string> * ((osm::isFloatingPoint(iterating_var) ? 26 : 25) - width_) +
                         feat(rst, "color") + getBrackets_close();
 
-                    update_output(output_);
+                    update_output(output_, iterating_var);
                 }
 
                 // Update of the whole progress bar:
                 else if (style_.find(style_p_) != std::string::npos && style_.find(style_l_) != std::string::npos &&
                          type_ == "complete") {
                     output_ =
-                        feat(crs, "left", 100) + getBrackets_open() + getColor() + style_l_ * width_ +
+                        feat(tcs, "crt") + getBrackets_open() + getColor() + style_l_ * width_ +
                         osm::empty_space<std::string> * ((osm::isFloatingPoint(iterating_var) ? 26 : 25) - width_) +
                         feat(rst, "color") + getBrackets_close() + getColor() + osm::empty_space<std::string> +
                         std::to_string(static_cast<int32_t>(round(iterating_var_++))) + feat(rst, "color") + style_p_;
 
-                    update_output(output_);
+                    update_output(output_, iterating_var);
                 }
 
                 // Update of the progress spinner:
                 else if (styles_map_.at("spinner").find(style_) != styles_map_.at("spinner").end()) {
-                    output_ = feat(crs, "left", 100) + getColor() +
+                    output_ = feat(tcs, "crt") + getColor() +
                               getStyle()[static_cast<uint64_t>(iterating_var_spin_) & 3] + feat(col, "green") +
                               ((osm::roundoff(iterating_var, 1) == osm::roundoff(max_, 1) - osm::one(iterating_var))
-                                   ? (static_cast<std::string>(feat(crs, "left", 100) + "0"))
+                                   ? (static_cast<std::string>(feat(tcs, "crt") + "0"))
                                    : "") +
                               feat(rst, "color");
 
-                    update_output(output_);
+                    update_output(output_, iterating_var);
                 }
 
                 else {
@@ -560,6 +626,20 @@ namespace osm {
                 }
             }
 
+            // redraw
+            /**
+             * @brief Print again the last line rendered by update, without modifying the ProgressBar state. It is used
+             * to restore the bar after something else has been written over it. Nothing is printed if the bar has
+             * never been updated.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             */
+            void redraw() const {
+                std::lock_guard<mutex_type> lock{mutex_};
+
+                osm::cout << line_ << std::flush;
+            }
+
             // print
             /**
              * @brief Prints on the screen the progress bar variable values.
@@ -599,9 +679,9 @@ namespace osm {
              * @brief Compute the remaining time for the completion of the progress bar.
              *
              * @tparam bar_type The type of the ProgressBar.
-             * @return The ProgressBar remaining time.
+             * @return The ProgressBar remaining time, formatted to be appended to the bar line.
              */
-            void remaining_time() {
+            std::string remaining_time() {
                 max_spin_ = osm::isFloatingPoint(max_) ? (osm::roundoff(max_ - min_, 1) * 10 + 1) : (max_ - min_ + 1);
 
                 duration time_taken = steady_clock::now() - begin_timer;
@@ -611,43 +691,64 @@ namespace osm {
                 std::chrono::seconds seconds_left =
                     std::chrono::duration_cast<std::chrono::seconds>(time_left - minutes_left);
 
-                osm::cout << "["
-                          << feat(sty, "italics") +
-                                 "Estimated time "
-                                 "left: " +
-                                 feat(rst, "italics")
-                          << feat(col, "green") << minutes_left.count() << feat(rst, "color") << "m "
-                          << feat(col, "green") << seconds_left.count() << feat(rst, "color") << "s"
-                          << "]" << feat(tcsc, "cln", 0);
+                return "[" + feat(sty, "italics") + "Estimated time left: " + feat(rst, "italics") +
+                       feat(col, "green") + std::to_string(minutes_left.count()) + feat(rst, "color") + "m " +
+                       feat(col, "green") + std::to_string(seconds_left.count()) + feat(rst, "color") + "s" + "]" +
+                       feat(tcsc, "cln", 0);
             }
 
             // update_output
             /**
-             * @brief Update the output of the progress bar.
+             * @brief Update the output of the progress bar. The whole line is stored, so that it can be printed again
+             * by the redraw method. The sparkline, if any, samples the rate and is drawn here, only when the line is
+             * printed: otherwise its last drawing is reused.
              *
              * @tparam bar_type The type of the ProgressBar.
              * @param output The output of the progress bar.
-             */
-            void update_output(std::string_view output) {
-                osm::cout << output << getColor()
-                          << ((message_ != osm::null_str<std::string>)
-                                  ? (osm::empty_space<std::string> + message_ + osm::empty_space<std::string>)
-                                  : osm::empty_space<std::string>)
-                          << feat(rst, "color");
+             * @param iterating_var The value of the progress bar indicator.
+             */
+            void update_output(std::string_view output, bar_type iterating_var) {
+                // The last update of the loop (max - 1, or max - 0.1 like the spinner for floating-point loops) is
+                // always printed, so that the bar doesn't stop short of 100%
+                const bool last = osm::isFloatingPoint(iterating_var)
+                                      ? osm::roundoff(iterating_var, 1) >= osm::roundoff(max_, 1) - 0.1
+                                      : iterating_var >= max_ - static_cast<bar_type>(1);
+                const bool print = !pacer_ || last || pacer_->ready();
+
+                line_.assign(output);
+                if (sparkline_.getWidth() > 0) {
+                    if (print) {
+                        sparkline_.sample(static_cast<double>(iterating_var));
+                        sparkline_.draw(sparkline_line_);
+                    }
+                    line_ += osm::empty_space<std::string>;
+                    line_ += getColor();
+                    line_ += sparkline_line_;
+                    line_ += feat(rst, "color");
+                }
+                line_ += getColor();
+                line_ += (message_ != osm::null_str<std::string>)
+                             ? (osm::empty_space<std::string> + message_ + osm::empty_space<std::string>)
+                             : osm::empty_space<std::string>;
+                line_ += feat(rst, "color");
 
                 if (time_flag_ == "on") {
                     ticks_occurred++;
-                    remaining_time();
+                    line_ += remaining_time();
                 }
 
-                osm::cout << std::flush;
+                if (print) {
+                    frame_.clear();
+                    frame_.add(line_);
+                    write_frame(frame_, pacer_);
+                }
             }
 
             //====================================================
             //     Private static attributes
             //====================================================
             static string_set_map styles_map_;
-            static std::mutex mutex_;
+            static mutex_type mutex_;
 
             //====================================================
             //     Private attributes
@@ -656,8 +757,11 @@ namespace osm {
             std::uint64_t ticks_occurred;
             bar_type max_, max_spin_, min_, iterating_var_, iterating_var_spin_, width_;
             std::string style_, style_p_, style_l_, type_, message_, brackets_open_, brackets_close_, output_, color_,
-                time_flag_, color_name_;
+                time_flag_, color_name_, line_, sparkline_line_;
             steady_clock::time_point begin, end, begin_timer;
+            FramePacer *pacer_;
+            FrameAssembler frame_;
+            Sparkline sparkline_;
     };
 
     //====================================================
@@ -697,7 +801,7 @@ namespace osm {
     };
 
     template <typename bar_type>
-    std::mutex ProgressBar<bar_type>::mutex_;
+    mutex_type ProgressBar<bar_type>::mutex_;
 }  // namespace osm
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
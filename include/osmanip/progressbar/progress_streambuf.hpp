@@ -0,0 +1,337 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file progress_streambuf.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_PROGRESSBAR_PROGRESSSTREAMBUF_HPP
+#define OSMANIP_PROGRESSBAR_PROGRESSSTREAMBUF_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/utility/generic.hpp>
+
+// STD headers
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ios>
+#include <iterator>
+#include <streambuf>
+#include <string>
+
+namespace osm {
+
+    //====================================================
+    //     ProgressStreambuf
+    //====================================================
+    /**
+     * @brief Stream buffer which forwards reads and writes to another stream buffer (e.g. the one of an
+     * std::ifstream or std::ofstream) and counts the transferred bytes, updating a linked ProgressBar whenever its
+     * percentage changes. It has no buffer of its own: blocks read or written through it (e.g. by
+     * std::istream::read) are passed to the underlying buffer without copies.
+     *
+     * The byte counter is atomic, so it can be polled from another thread, while the buffer itself, like any stream
+     * buffer, must be used by one thread at a time.
+     *
+     * @tparam bar_type The type of the ProgressBar, whose range (max - min) is the expected number of bytes.
+     */
+    template <typename bar_type>
+    class ProgressStreambuf : public std::streambuf {
+        public:
+
+            //====================================================
+            //     Constructors
+            //====================================================
+
+            // Parametric constructor
+            /**
+             * @brief Construct a new ProgressStreambuf object.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param target The stream buffer which reads and writes are forwarded to, which must outlive this one.
+             * @param bar The ProgressBar updated with the transferred bytes, which must outlive this buffer. Set to
+             * nullptr to only count the bytes.
+             */
+            explicit ProgressStreambuf(std::streambuf *target, ProgressBar<bar_type> *bar = nullptr)
+                : target_(target),
+                  bar_(bar),
+                  bytes_(0),
+                  percentage_(-1),
+                  throughput_(false),
+                  message_(bar ? bar->getMessage() : ""),
+                  start_(steady_clock::now()) {}
+
+            //====================================================
+            //     Setters
+            //====================================================
+
+            // enableThroughput
+            /**
+             * @brief Flag to show the throughput (e.g. "12.5 MB/s") after the message of the ProgressBar, which is
+             * the one it had when it was linked.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param throughput Set to True to show the throughput. Otherwise set to False.
+             */
+            void enableThroughput(bool throughput) { throughput_ = throughput; }
+
+            //====================================================
+            //     Getters
+            //====================================================
+
+            // getTarget
+            /**
+             * @brief Get the stream buffer which reads and writes are forwarded to.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return std::streambuf* The underlying stream buffer.
+             */
+            std::streambuf *getTarget() const { return target_; }
+
+            // getProgressBar
+            /**
+             * @brief Get the linked ProgressBar.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return ProgressBar<bar_type>* The ProgressBar, nullptr if not set.
+             */
+            ProgressBar<bar_type> *getProgressBar() const { return bar_; }
+
+            // getBytes
+            /**
+             * @brief Get the number of bytes read and written since the construction.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return uint64_t The number of transferred bytes.
+             */
+            uint64_t getBytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+            // getThroughput
+            /**
+             * @brief Get the average throughput since the construction.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return double The throughput in bytes per second.
+             */
+            double getThroughput() const {
+                const double seconds = std::chrono::duration<double>(steady_clock::now() - start_).count();
+                return seconds > 0 ? static_cast<double>(getBytes()) / seconds : 0;
+            }
+
+            // isThroughputEnabled
+            /**
+             * @brief Return True if the throughput is shown in the ProgressBar. Otherwise return False.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return bool The throughput flag.
+             */
+            bool isThroughputEnabled() const { return throughput_; }
+
+        protected:
+
+            //====================================================
+            //     Virtual methods
+            //====================================================
+
+            // xsgetn
+            /**
+             * @brief Read a block from the underlying buffer.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param s The destination.
+             * @param n The number of chars to read.
+             * @return std::streamsize The number of chars read.
+             */
+            std::streamsize xsgetn(char *s, std::streamsize n) override { return count(target_->sgetn(s, n)); }
+
+            // xsputn
+            /**
+             * @brief Write a block into the underlying buffer.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param s The source.
+             * @param n The number of chars to write.
+             * @return std::streamsize The number of chars written.
+             */
+            std::streamsize xsputn(const char *s, std::streamsize n) override { return count(target_->sputn(s, n)); }
+
+            // underflow
+            /**
+             * @brief Peek the next char of the underlying buffer.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return int_type The next char, or EOF.
+             */
+            int_type underflow() override { return target_->sgetc(); }
+
+            // uflow
+            /**
+             * @brief Read the next char of the underlying buffer.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return int_type The char read, or EOF.
+             */
+            int_type uflow() override {
+                int_type ch = target_->sbumpc();
+                if (!traits_type::eq_int_type(ch, traits_type::eof())) count(1);
+                return ch;
+            }
+
+            // overflow
+            /**
+             * @brief Write a char into the underlying buffer.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param ch The char to write, EOF to do nothing.
+             * @return int_type A value other than EOF on success.
+             */
+            int_type overflow(int_type ch) override {
+                if (traits_type::eq_int_type(ch, traits_type::eof())) return traits_type::not_eof(ch);
+
+                int_type result = target_->sputc(traits_type::to_char_type(ch));
+                if (!traits_type::eq_int_type(result, traits_type::eof())) count(1);
+                return result;
+            }
+
+            // pbackfail
+            /**
+             * @brief Put back a char into the underlying buffer, removing it from the count.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param ch The char to put back, EOF to put back the last char read.
+             * @return int_type A value other than EOF on success.
+             */
+            int_type pbackfail(int_type ch) override {
+                int_type result = traits_type::eq_int_type(ch, traits_type::eof())
+                                      ? target_->sungetc()
+                                      : target_->sputbackc(traits_type::to_char_type(ch));
+                if (!traits_type::eq_int_type(result, traits_type::eof())) bytes_.fetch_sub(1);
+                return result;
+            }
+
+            // showmanyc
+            /**
+             * @brief Get the number of chars available in the underlying buffer.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return std::streamsize The number of chars available without blocking.
+             */
+            std::streamsize showmanyc() override { return target_->in_avail(); }
+
+            // seekoff
+            /**
+             * @brief Move the position of the underlying buffer. The moved bytes are not counted.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return pos_type The new position.
+             */
+            pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+                return target_->pubseekoff(off, dir, which);
+            }
+
+            // seekpos
+            /**
+             * @brief Move the position of the underlying buffer. The moved bytes are not counted.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return pos_type The new position.
+             */
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+                return target_->pubseekpos(pos, which);
+            }
+
+            // sync
+            /**
+             * @brief Synchronize the underlying buffer.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return int The result of the underlying sync.
+             */
+            int sync() override { return target_->pubsync(); }
+
+        private:
+
+            //====================================================
+            //     Private methods
+            //====================================================
+
+            // count
+            /**
+             * @brief Add transferred bytes to the counter and update the ProgressBar if its percentage has changed.
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @param n The number of transferred bytes.
+             * @return std::streamsize The number of transferred bytes.
+             */
+            std::streamsize count(std::streamsize n) {
+                if (n <= 0) return n;
+
+                const uint64_t bytes = bytes_.fetch_add(static_cast<uint64_t>(n), std::memory_order_relaxed) +
+                                       static_cast<uint64_t>(n);
+                if (!bar_) return n;
+
+                // The bar is updated with the last index of a loop over the bytes, as if update was called for each
+                const double total = static_cast<double>(bar_->getMax() - bar_->getMin());
+                const auto percentage =
+                    static_cast<int32_t>(total > 0 ? std::min(100.0, 100.0 * static_cast<double>(bytes) / total) : 100);
+                if (percentage <= percentage_) return n;
+
+                percentage_ = percentage;
+                if (throughput_) bar_->setMessage(message_ + (message_.empty() ? "" : " ") + formatThroughput());
+                bar_->update(static_cast<bar_type>(bar_->getMin() + std::min(static_cast<double>(bytes), total) -
+                                                   static_cast<double>(osm::one(bar_->getMin()))));
+                return n;
+            }
+
+            // formatThroughput
+            /**
+             * @brief Format the throughput with the unit which fits it (e.g. "12.5 MB/s").
+             *
+             * @tparam bar_type The type of the ProgressBar.
+             * @return std::string The formatted throughput.
+             */
+            std::string formatThroughput() const {
+                static constexpr const char *units[] = {"B/s", "kB/s", "MB/s", "GB/s", "TB/s"};
+
+                double throughput = getThroughput();
+                size_t unit = 0;
+                while (throughput >= 1000 && unit + 1 < std::size(units)) {
+                    throughput /= 1000;
+                    unit++;
+                }
+
+                char text[32];
+                std::snprintf(text, sizeof(text), "%.1f %s", throughput, units[unit]);
+                return text;
+            }
+
+            //====================================================
+            //     Private attributes
+            //====================================================
+            std::streambuf *target_;
+            ProgressBar<bar_type> *bar_;
+            std::atomic<uint64_t> bytes_;
+            int32_t percentage_;
+            bool throughput_;
+            std::string message_;
+            steady_clock::time_point start_;
+    };
+}  // namespace osm
+
+#endif
@@ -0,0 +1,243 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file sparkline.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_PROGRESSBAR_SPARKLINE_HPP
+#define OSMANIP_PROGRESSBAR_SPARKLINE_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/generic.hpp>
+
+// STD headers
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace osm {
+
+    //====================================================
+    //     Sparkline
+    //====================================================
+    /**
+     * @brief Rate history of a progress, drawn with block glyphs (e.g. "▂▄▇█▆  ▁"). The rate of the progress is
+     * sampled at most once per interval into a fixed-size ring buffer, and each sample is drawn with a glyph whose
+     * height is relative to the highest rate in the window: a slowdown is a lower glyph and a stall is a blank. It
+     * doesn't allocate memory except for the drawn string.
+     *
+     */
+    class Sparkline {
+        public:
+
+            //====================================================
+            //     Constants
+            //====================================================
+            static constexpr size_t max_width = 64;
+
+            //====================================================
+            //     Constructors
+            //====================================================
+
+            // Parametric constructor
+            /**
+             * @brief Construct a new Sparkline object.
+             *
+             * @param width The number of samples (and glyphs) in the window, 0 to disable the sparkline.
+             * @param interval The minimum time between two samples.
+             * @throws std::runtime_error if the width is higher than max_width.
+             */
+            explicit Sparkline(size_t width = 0, std::chrono::milliseconds interval = std::chrono::milliseconds(250))
+                : width_(0), interval_(interval) {
+                setWidth(width);
+            }
+
+            //====================================================
+            //     Setters
+            //====================================================
+
+            // setWidth
+            /**
+             * @brief Set the number of samples in the window, clearing the history.
+             *
+             * @param width The number of samples, 0 to disable the sparkline.
+             * @throws std::runtime_error if the width is higher than max_width.
+             */
+            void setWidth(size_t width) {
+                if (width > max_width) {
+                    throw osm::except_error_func("Sparkline width", std::to_string(width), "is too large!");
+                }
+                width_ = width;
+                reset();
+            }
+
+            // setInterval
+            /**
+             * @brief Set the minimum time between two samples.
+             *
+             * @param interval The interval.
+             */
+            void setInterval(std::chrono::milliseconds interval) { interval_ = interval; }
+
+            //====================================================
+            //     Getters
+            //====================================================
+
+            // getWidth
+            /**
+             * @brief Get the number of samples in the window.
+             *
+             * @return size_t The width, 0 if the sparkline is disabled.
+             */
+            size_t getWidth() const { return width_; }
+
+            // getInterval
+            /**
+             * @brief Get the minimum time between two samples.
+             *
+             * @return std::chrono::milliseconds The interval.
+             */
+            std::chrono::milliseconds getInterval() const { return interval_; }
+
+            // getSamples
+            /**
+             * @brief Get the number of samples in the window, which is at most its width.
+             *
+             * @return size_t The number of samples.
+             */
+            size_t getSamples() const { return count_; }
+
+            //====================================================
+            //     Methods
+            //====================================================
+
+            // sample
+            /**
+             * @brief Add the rate since the previous sample to the window, if at least an interval has passed. The
+             * first call only sets the starting point. If several intervals have passed (the progress was not sampled
+             * since it stalled) a stall is added for each of them but the last, which gets the rate. A progress which
+             * goes back (e.g. a restarted loop) counts as a stall. The calls are thus expected at least once per
+             * interval while the progress goes on.
+             *
+             * @param value The current value of the progress.
+             * @param now The current time.
+             * @return bool True if a sample has been added. Otherwise False.
+             */
+            bool sample(double value, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) {
+                if (width_ == 0) return false;
+                if (!started_) {
+                    started_ = true;
+                    last_value_ = value, last_time_ = now;
+                    return false;
+                }
+
+                std::chrono::duration<double> elapsed = now - last_time_;
+                if (elapsed < interval_ || elapsed.count() <= 0) return false;
+
+                if (interval_.count() > 0) {
+                    const std::chrono::duration<double> interval = interval_;
+                    const auto stalls = static_cast<uint64_t>(elapsed / interval) - 1;
+                    for (uint64_t i = 0; i < std::min<uint64_t>(stalls, width_); i++) push(0);
+                    elapsed -= interval * static_cast<double>(stalls);
+                }
+
+                push(std::max(0.0, (value - last_value_) / elapsed.count()));
+                last_value_ = value, last_time_ = now;
+                return true;
+            }
+
+            // str
+            /**
+             * @brief Draw the window, oldest sample first. Missing samples are drawn as blanks, so that the width of
+             * the drawing is constant.
+             *
+             * @return std::string The drawing, of width glyphs.
+             */
+            std::string str() const {
+                std::string drawing;
+                draw(drawing);
+                return drawing;
+            }
+
+            // draw
+            /**
+             * @brief Draw the window into a string, like str, reusing its memory.
+             *
+             * @param drawing The string, whose content is replaced by the drawing.
+             */
+            void draw(std::string &drawing) const {
+                static constexpr const char *glyphs[] = {"▁", "▂", "▃", "▄", "▅", "▆", "▇", "█"};
+
+                double highest = 0;
+                for (size_t i = 0; i < count_; i++) highest = std::max(highest, rates_[i]);
+
+                drawing.assign(width_ - count_, ' ');
+                for (size_t i = 0; i < count_; i++) {
+                    const double rate = rates_[(head_ + width_ - count_ + i) % width_];
+                    if (rate <= 0) {
+                        drawing += ' ';
+                        continue;
+                    }
+                    drawing += glyphs[std::min<size_t>(7, static_cast<size_t>(std::lround(7 * rate / highest)))];
+                }
+            }
+
+            // reset
+            /**
+             * @brief Clear the history. The next sample sets the starting point again.
+             *
+             */
+            void reset() {
+                head_ = 0, count_ = 0;
+                started_ = false;
+                last_value_ = 0;
+            }
+
+        private:
+
+            //====================================================
+            //     Private methods
+            //====================================================
+
+            // push
+            /**
+             * @brief Add a rate to the window, replacing the oldest one if it is full.
+             *
+             * @param rate The rate.
+             */
+            void push(double rate) {
+                rates_[head_] = rate;
+                head_ = (head_ + 1) % width_;
+                count_ = std::min(count_ + 1, width_);
+            }
+
+            //====================================================
+            //     Private attributes
+            //====================================================
+            size_t width_, head_ = 0, count_ = 0;
+            std::chrono::milliseconds interval_;
+            std::array<double, max_width> rates_{};
+            double last_value_ = 0;
+            std::chrono::steady_clock::time_point last_time_;
+            bool started_ = false;
+    };
+}  // namespace osm
+
+#endif
@@ -0,0 +1,101 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file ansi_parser.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_ANSIPARSER_HPP
+#define OSMANIP_UTILITY_ANSIPARSER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <cstdint>
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     AnsiHandler
+    //====================================================
+    /**
+     * @brief Interface of the objects which receive the events of an AnsiParser: a run of printable text, a C0 control
+     * char (e.g. '\n' or '\r'), a CSI sequence (final byte, parameters and private prefix such as '?', or 0) and an
+     * escape sequence (final byte). Omitted parameters are 0. All the methods do nothing by default, so a handler only
+     * overrides the events it needs.
+     *
+     */
+    class AnsiHandler {
+        public:
+
+            // Destructor
+            virtual ~AnsiHandler() = default;
+
+            // Methods
+            virtual void text([[maybe_unused]] std::string_view data) {}
+            virtual void control([[maybe_unused]] char ch) {}
+            virtual void csi([[maybe_unused]] char code, [[maybe_unused]] const int32_t *params,
+                             [[maybe_unused]] size_t count, [[maybe_unused]] char prefix) {}
+            virtual void escape([[maybe_unused]] char code) {}
+    };
+
+    //====================================================
+    //     AnsiParser
+    //====================================================
+    /**
+     * @brief This class is a streaming parser of the ANSI escape sequences (a subset of the DEC VT500 state machine).
+     * The input can be split in chunks anywhere, even inside a sequence, since the state is kept between the calls to
+     * parse, and it uses constant memory. The printable text is reported in runs which point into the chunk, without
+     * copies. OSC, DCS, SOS, PM and APC strings and the sequences with intermediate bytes are skipped.
+     *
+     */
+    class AnsiParser {
+        public:
+
+            // Constants
+            static constexpr size_t max_params = 16;
+
+            // Constructors
+            AnsiParser();
+
+            // Methods
+            void parse(std::string_view chunk, AnsiHandler &handler);
+            void reset();
+
+        private:
+
+            // Enums
+            typedef enum {
+                GROUND = 0,
+                ESCAPE = 1,
+                ESCAPE_INTERMEDIATE = 2,
+                CSI_PARAM = 3,
+                CSI_IGNORE = 4,
+                STRING = 5,
+                STRING_ESCAPE = 6
+            } State;
+
+            // Members
+            State state_;
+            int32_t params_[max_params];
+            size_t count_;
+            char prefix_;
+
+            // Methods
+            void enterEscape();
+            void parseParam(char ch);
+    };
+}  // namespace osm
+
+#endif
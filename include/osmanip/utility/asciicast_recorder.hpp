@@ -0,0 +1,108 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file asciicast_recorder.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_ASCIICASTRECORDER_HPP
+#define OSMANIP_UTILITY_ASCIICASTRECORDER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/recorder.hpp>
+
+// STD headers
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     AsciicastRecorder
+    //====================================================
+    /**
+     * @brief This class records a terminal session (e.g. the output of osm::cout, see Ostreambuf::setRecorder) into a
+     * file in the asciicast v2 format, which can be replayed with asciinema. Recording a chunk only takes a timestamp
+     * and a copy into a memory buffer: a background thread periodically encodes the buffered chunks as JSON events
+     * and appends them to the file. If osmanip is built in single-threaded mode there is no background thread and the
+     * buffer is written when it is full or flushed.
+     *
+     */
+    class AsciicastRecorder : public Recorder {
+        public:
+
+            // Constructors and destructor
+            explicit AsciicastRecorder(std::string_view filename, uint32_t width = 0, uint32_t height = 0);
+            AsciicastRecorder(const AsciicastRecorder &) = delete;
+            AsciicastRecorder &operator=(const AsciicastRecorder &) = delete;
+            ~AsciicastRecorder() override;
+
+            // Getters
+            std::string getFilename() const;
+            uint32_t getWidth() const;
+            uint32_t getHeight() const;
+            uint64_t getEvents();
+
+            // Methods
+            void record(std::string_view data) override;
+            void flush();
+            void close();
+
+        private:
+
+            // Aliases
+            using clock = std::chrono::steady_clock;
+
+            // Structs
+            struct Event {
+                    int64_t time;
+                    size_t offset, size;
+            };
+
+            // Members
+            std::string filename_;
+            uint32_t width_, height_;
+            std::FILE *file_;
+            clock::time_point start_;
+            uint64_t events_;
+
+            // Chunks recorded and not yet taken by the writer, guarded by mutex_
+            std::mutex mutex_;
+            std::condition_variable wake_, done_;
+            std::string pending_;
+            std::vector<Event> pending_events_;
+            bool stop_;
+            uint64_t flush_requests_, flushes_;
+
+            // Chunks being written, owned by the writer
+            std::string writing_;
+            std::vector<Event> writing_events_;
+            std::string out_, joined_, carry_;
+            std::thread writer_;
+
+            // Methods
+            void work();
+            void write();
+    };
+}  // namespace osm
+
+#endif
@@ -0,0 +1,88 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file flight_recorder.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_FLIGHTRECORDER_HPP
+#define OSMANIP_UTILITY_FLIGHTRECORDER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/recorder.hpp>
+
+// STD headers
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     FlightRecorder
+    //====================================================
+    /**
+     * @brief This class keeps the last bytes written to it (e.g. the output of osm::cout, see
+     * Ostreambuf::setRecorder) in a fixed-size in-memory ring buffer, without any disk I/O. The content can be dumped
+     * to a file on demand, on a fatal signal or on exit, to get the console context of a crashed process.
+     *
+     * Writers never lock: each write reserves its bytes with an atomic counter and copies them into the ring, so
+     * dumping from a signal handler is safe. A dump racing with a write may show the newest bytes torn.
+     *
+     */
+    class FlightRecorder : public Recorder {
+        public:
+
+            // Constructors and destructor
+            explicit FlightRecorder(size_t capacity = 1 << 20);
+            FlightRecorder(const FlightRecorder &) = delete;
+            FlightRecorder &operator=(const FlightRecorder &) = delete;
+            ~FlightRecorder() override;
+
+            // Setters
+            void setDumpPath(std::string_view path);
+            void enableDumpOnCrash(bool dump_on_crash);
+            void enableDumpOnExit(bool dump_on_exit);
+
+            // Getters
+            size_t getCapacity() const;
+            uint64_t getRecorded() const;
+            std::string getDumpPath() const;
+            bool isDumpOnCrashEnabled() const;
+            bool isDumpOnExitEnabled() const;
+
+            // Methods
+            void record(std::string_view data) override;
+            std::string str() const;
+            bool dump() const;
+            bool dump(std::string_view path) const;
+            void clear();
+
+        private:
+
+            // Members
+            std::unique_ptr<char[]> buffer_;
+            size_t capacity_;
+            std::atomic<uint64_t> head_;
+            char dump_path_[4096];
+
+            // Methods
+            bool dumpTo(const char *path) const;
+    };
+}  // namespace osm
+
+#endif
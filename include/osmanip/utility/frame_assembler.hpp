@@ -0,0 +1,84 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file frame_assembler.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_FRAMEASSEMBLER_HPP
+#define OSMANIP_UTILITY_FRAMEASSEMBLER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     FrameAssembler
+    //====================================================
+    /**
+     * @brief This class is used to assemble a frame from many fragments without concatenating them. Large fragments
+     * are only referenced (they must stay alive and unchanged until the frame is written), while small fragments and
+     * numbers are packed together into an internal buffer. The frame is then written with a single scatter-gather
+     * write, or fragment by fragment into an output stream.
+     *
+     */
+    class FrameAssembler {
+        public:
+
+            // Constructors
+            FrameAssembler();
+
+            // Getters
+            size_t size() const;
+            size_t getSegments() const;
+
+            // Methods
+            FrameAssembler &add(std::string_view fragment);
+            FrameAssembler &copy(std::string_view str);
+            FrameAssembler &addNumber(int64_t number);
+            FrameAssembler &append(const FrameAssembler &other);
+            void clear();
+            std::string str() const;
+            void write(std::ostream &os) const;
+            void write(int fd) const;
+
+            // Constants
+            static constexpr size_t copy_threshold = 64;
+
+        private:
+
+            // Structs
+            struct Segment {
+                    const char *data;  // nullptr if the segment is stored into the arena
+                    size_t offset, size;
+            };
+
+            // Methods
+            std::string_view view(const Segment &segment) const;
+
+            // Members
+            std::vector<Segment> segments_;
+            std::string arena_;
+            size_t size_;
+    };
+}  // namespace osm
+
+#endif
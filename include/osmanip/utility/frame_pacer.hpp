@@ -0,0 +1,92 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file frame_pacer.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_FRAMEPACER_HPP
+#define OSMANIP_UTILITY_FRAMEPACER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/locking.hpp>
+
+// STD headers
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     FramePacer
+    //====================================================
+    /**
+     * @brief This class is used to adapt the frame rate of the animated widgets (canvases, progress bars) to the
+     * speed of the output channel. The latency of each frame write and the number of bytes per frame are measured:
+     * when the channel is slow (e.g. a terminal over SSH) the frame rate is lowered and the widgets are asked to
+     * reduce their detail, so that the output never slows down the workload itself.
+     *
+     */
+    class FramePacer {
+        public:
+
+            // Aliases
+            using clock = std::chrono::steady_clock;
+            using seconds = std::chrono::duration<double>;
+
+            // Constructors
+            explicit FramePacer(double max_fps = 30, double min_fps = 1);
+
+            // Setters
+            void setMaxFps(double max_fps);
+            void setMinFps(double min_fps);
+            void setBytesPerSecond(uint64_t bytes_per_second);
+
+            // Getters
+            double getMaxFps() const;
+            double getMinFps() const;
+            uint64_t getBytesPerSecond() const;
+            double getFps();
+            bool isReducedDetail();
+
+            // Methods
+            bool ready();
+            void record(uint64_t bytes, seconds latency);
+            void write(std::ostream &os, std::string_view frame);
+            void write(std::ostream &os, const FrameAssembler &frame);
+            void write(int fd, const FrameAssembler &frame);
+            void reset();
+
+        private:
+
+            // Methods
+            void adapt();
+
+            // Members
+            double max_fps_, min_fps_;
+            uint64_t bytes_per_second_;
+            double latency_, bytes_;
+            seconds interval_;
+            clock::time_point last_frame_;
+            bool first_frame_;
+            mutex_type mutex_;
+    };
+}  // namespace osm
+
+#endif
@@ -0,0 +1,89 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file html_converter.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_HTMLCONVERTER_HPP
+#define OSMANIP_UTILITY_HTMLCONVERTER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_parser.hpp>
+
+// STD headers
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     HtmlConverter
+    //====================================================
+    /**
+     * @brief This class converts text with ANSI escape sequences (e.g. a log of colored output) into HTML. The SGR
+     * state (colors and attributes) is mapped to CSS classes (see stylesheet), opening a new span only when it
+     * changes, while the other sequences are dropped. The input is converted in chunks, with constant memory, so a
+     * file of any size can be streamed through it.
+     *
+     */
+    class HtmlConverter : public AnsiHandler {
+        public:
+
+            // Constructors and destructor
+            explicit HtmlConverter(std::ostream &out, bool document = true);
+            HtmlConverter(const HtmlConverter &) = delete;
+            HtmlConverter &operator=(const HtmlConverter &) = delete;
+            ~HtmlConverter() override;
+
+            // Methods
+            void write(std::string_view chunk);
+            void finish();
+            static uint64_t convert(std::istream &in, std::ostream &out, bool document = true);
+            static std::string stylesheet();
+
+        private:
+
+            // Structs
+            struct Style {
+                    int32_t fg, bg;
+                    uint32_t attributes;
+
+                    bool operator==(const Style &other) const;
+                    bool operator!=(const Style &other) const;
+            };
+
+            // Members
+            std::ostream &out_;
+            bool document_, finished_, pending_cr_, span_open_;
+            AnsiParser parser_;
+            Style style_, span_style_;
+            std::string buffer_;
+
+            // Methods
+            void text(std::string_view data) override;
+            void control(char ch) override;
+            void csi(char code, const int32_t *params, size_t count, char prefix) override;
+            void applySgr(const int32_t *params, size_t count);
+            void updateSpan();
+            void openSpan();
+            void flushBuffer(bool force);
+    };
+}  // namespace osm
+
+#endif
@@ -22,6 +22,8 @@
 //====================================================
 
 // My headers
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/frame_pacer.hpp>
 #include <osmanip/utility/output_redirector.hpp>
 
 // STD headers
@@ -33,10 +35,17 @@ namespace osm {
     //     Global variables
     //====================================================
 
+    extern Ostreambuf cout_buf;        /// Buffer of osm::cout
     extern std::ostream cout;          /// Linked to standard output
     extern OutputRedirector redirout;  /// Linked to output
                                        /// redirection
 
+    //====================================================
+    //     Functions
+    //====================================================
+    extern bool is_cout_direct();
+    extern void write_frame(const FrameAssembler &frame, FramePacer *pacer = nullptr);
+
 }  // namespace osm
 
 #endif  // OSMANIP_COUT_INCLUDE_UTILITY_IOSTREAM_HPP
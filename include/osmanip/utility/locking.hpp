@@ -0,0 +1,62 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file locking.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_LOCKING_HPP
+#define OSMANIP_UTILITY_LOCKING_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <mutex>
+
+namespace osm {
+
+    //====================================================
+    //     null_mutex
+    //====================================================
+    /**
+     * @brief Mutex which does nothing. It is used in place of std::mutex when osmanip is built in single-threaded mode,
+     * so that streams and progress bars don't pay any synchronization cost.
+     *
+     */
+    class null_mutex {
+        public:
+
+            void lock() noexcept {}
+            void unlock() noexcept {}
+            bool try_lock() noexcept { return true; }
+    };
+
+    //====================================================
+    //     Aliases
+    //====================================================
+
+    // mutex_type
+    /**
+     * @brief Mutex used by osmanip streams and progress bars. It is std::mutex by default and null_mutex if the
+     * OSMANIP_SINGLE_THREADED macro is defined (CMake option of the same name). The macro must be the same for the
+     * library and the code which uses it.
+     *
+     */
+#ifdef OSMANIP_SINGLE_THREADED
+    using mutex_type = null_mutex;
+#else
+    using mutex_type = std::mutex;
+#endif
+}  // namespace osm
+
+#endif
@@ -0,0 +1,47 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file recorder.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_RECORDER_HPP
+#define OSMANIP_UTILITY_RECORDER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     Recorder
+    //====================================================
+    /**
+     * @brief Interface of the sinks which the output of an Ostreambuf (e.g. osm::cout) can be routed into, see
+     * Ostreambuf::setRecorder. Each flush of the stream is passed to record as a single chunk.
+     *
+     */
+    class Recorder {
+        public:
+
+            // Destructor
+            virtual ~Recorder() = default;
+
+            // Methods
+            virtual void record(std::string_view data) = 0;
+    };
+}  // namespace osm
+
+#endif
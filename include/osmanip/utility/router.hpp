@@ -0,0 +1,154 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file router.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_ROUTER_HPP
+#define OSMANIP_UTILITY_ROUTER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/locking.hpp>
+#include <osmanip/utility/recorder.hpp>
+#include <osmanip/utility/sstream.hpp>
+
+// STD headers
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     Router
+    //====================================================
+    /**
+     * @brief This class routes the output to different sinks by tag, e.g. one per component of a server. Each tag is
+     * written through its own stream (see TaggedStream), while the output recorded without a tag (e.g. of osm::cout,
+     * see Ostreambuf::setRecorder) has tag 0. The output of the tags without a route goes to the route of tag 0, if
+     * any.
+     *
+     * The routes are read on every write without locks: each write only announces itself on an atomic counter and
+     * loads the sink. Changing a route waits for the writes which may still use the previous sink, so the previous
+     * sink can be destroyed as soon as route returns. Routes must not be changed from inside a sink.
+     *
+     */
+    class Router : public Recorder {
+        public:
+
+            // Constants
+            static constexpr uint32_t max_tags = 256;
+
+            // Constructors and destructor
+            Router();
+            Router(const Router &) = delete;
+            Router &operator=(const Router &) = delete;
+            ~Router() override;
+
+            // Setters
+            void route(uint32_t tag, Recorder *sink);
+
+            // Getters
+            Recorder *getRoute(uint32_t tag) const;
+            uint64_t getDropped() const;
+
+            // Methods
+            void record(std::string_view data) override;
+            void record(uint32_t tag, std::string_view data);
+
+        private:
+
+            // Structs
+            struct alignas(64) Counter {
+                    std::atomic<uint64_t> value{0};
+            };
+
+            // Members
+            std::atomic<Recorder *> routes_[max_tags];
+            std::atomic<uint32_t> epoch_;
+            Counter writers_[2];
+            std::atomic<uint64_t> dropped_;
+            mutex_type update_mutex_;
+
+            // Methods
+            void synchronize();
+    };
+
+    //====================================================
+    //     OstreamRecorder
+    //====================================================
+    /**
+     * @brief This class is a sink which writes the output into an std::ostream (e.g. std::cout or an std::ofstream),
+     * flushing it after each chunk. It can be used as a route of a Router.
+     *
+     */
+    class OstreamRecorder : public Recorder {
+        public:
+
+            // Constructors
+            explicit OstreamRecorder(std::ostream &out);
+
+            // Methods
+            void record(std::string_view data) override;
+
+        private:
+
+            // Members
+            std::ostream &out_;
+            mutex_type mutex_;
+    };
+
+    //====================================================
+    //     TaggedStream
+    //====================================================
+    /**
+     * @brief This class is an output stream whose output is routed by a Router with a fixed tag. It has its own
+     * buffer, which is passed to the Router at each flush: streams of different tags can thus be written concurrently
+     * by different threads without sharing any lock.
+     *
+     */
+    class TaggedStream : public std::ostream {
+        public:
+
+            // Constructors and destructor
+            TaggedStream(Router &router, uint32_t tag);
+            TaggedStream(const TaggedStream &) = delete;
+            TaggedStream &operator=(const TaggedStream &) = delete;
+            ~TaggedStream() override;
+
+            // Getters
+            uint32_t getTag() const;
+
+        private:
+
+            // Structs
+            struct TagRecorder : public Recorder {
+                    Router &router;
+                    uint32_t tag;
+
+                    TagRecorder(Router &router, uint32_t tag) : router(router), tag(tag) {}
+                    void record(std::string_view data) override { router.record(tag, data); }
+            };
+
+            // Members
+            TagRecorder recorder_;
+            Ostreambuf buffer_;
+    };
+}  // namespace osm
+
+#endif
@@ -20,6 +20,10 @@
 //     Headers
 //====================================================
 
+// My headers
+#include <osmanip/utility/locking.hpp>
+#include <osmanip/utility/recorder.hpp>
+
 // STD headers
 #include <stdint.h>
 
@@ -45,7 +49,7 @@ namespace osm {
             ~Stringbuf() override;
 
             // Getters
-            std::mutex &getMutex();
+            mutex_type &getMutex();
 
             // Methods
             int32_t sync() override;
@@ -53,7 +57,7 @@ namespace osm {
         private:
 
             // Attributes
-            std::mutex mutex_;
+            mutex_type mutex_;
     };
 
     //====================================================
@@ -76,9 +80,11 @@ namespace osm {
 
             // Setters
             void setOstream(std::ostream *ostream);
+            void setRecorder(Recorder *recorder, bool echo = false);
 
             // Getters
             std::ostream *getOstream();
+            Recorder *getRecorder();
 
             // Methods
             int32_t sync() override;
@@ -88,9 +94,12 @@ namespace osm {
             // Methods
             void sync_output();
             void sync_redirection();
+            void sync_recorder();
 
             // Members
             std::ostream *ostream_;
+            Recorder *recorder_;
+            bool echo_;
     };
 
 }  // namespace osm
@@ -23,7 +23,9 @@
 // STD headers
 #include <stdint.h>
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 namespace osm {
 
@@ -39,7 +41,9 @@ namespace osm {
     [[maybe_unused]] extern int32_t get_ansi_csi_number(const std::string &csi);
     [[maybe_unused]] extern char get_ansi_csi_code(const std::string &csi);
     [[maybe_unused]] extern void handle_csi(const std::string &csi_str, std::string &dst_str, int32_t *dst_crsr_pos);
+    extern size_t display_width(std::string_view str);
+    extern size_t display_prefix(std::string_view str, size_t max_width, size_t *width = nullptr);
 
 }  // namespace osm
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file terminal.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_TERMINAL_HPP
+#define OSMANIP_UTILITY_TERMINAL_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <cstdint>
+#include <utility>
+
+namespace osm {
+
+    //====================================================
+    //     Functions
+    //====================================================
+    extern std::pair<uint32_t, uint32_t> terminal_size();
+    extern uint64_t terminal_resize_count();
+}  // namespace osm
+
+#endif
@@ -0,0 +1,77 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file thread_pool.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#pragma once
+#ifndef OSMANIP_UTILITY_THREADPOOL_HPP
+#define OSMANIP_UTILITY_THREADPOOL_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     ThreadPool
+    //====================================================
+    /**
+     * @brief This class is used to split a CPU-bound job (e.g. encoding the rows of a large canvas) into independent
+     * tasks run by a fixed set of threads. The threads are created once and sleep between jobs. If osmanip is built in
+     * single-threaded mode, the tasks are run by the calling thread.
+     *
+     */
+    class ThreadPool {
+        public:
+
+            // Constructors and destructor
+            explicit ThreadPool(size_t threads = 0);
+            ThreadPool(const ThreadPool &) = delete;
+            ThreadPool &operator=(const ThreadPool &) = delete;
+            ~ThreadPool();
+
+            // Getters
+            size_t getThreads() const;
+
+            // Methods
+            void run(size_t tasks, const std::function<void(size_t)> &task);
+
+        private:
+
+            // Methods
+            void work();
+            void runTasks(std::unique_lock<std::mutex> &lock);
+
+            // Members
+            std::vector<std::thread> workers_;
+            std::mutex run_mutex_, mutex_;
+            std::condition_variable wake_, done_;
+            const std::function<void(size_t)> *task_;
+            size_t tasks_, next_, pending_;
+            uint64_t generation_;
+            bool stop_;
+            std::exception_ptr error_;
+    };
+}  // namespace osm
+
+#endif
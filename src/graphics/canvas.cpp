@@ -15,14 +15,20 @@
 
 // My headers
 #include <osmanip/graphics/canvas.hpp>
+#include <osmanip/graphics/image.hpp>
 #include <osmanip/manipulators/colsty.hpp>
 #include <osmanip/manipulators/common.hpp>
 #include <osmanip/manipulators/cursor.hpp>
 #include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/strings.hpp>
+#include <osmanip/utility/terminal.hpp>
 
 // STD headers
+#include <algorithm>
 #include <cstdint>
-#include <sstream>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -38,6 +44,39 @@ namespace osm {
         {"+", "-", "+", "|", "|", "+", "-", "+"},
         {"\u250c", "\u2500", "\u2510", "\u2502", "\u2502", "\u2514", "\u2500", "\u2518"}};
 
+    //====================================================
+    //     Constants
+    //====================================================
+
+    // Minimum number of cells for which the rows are encoded in parallel
+    static constexpr uint64_t parallel_threshold = 8192;
+
+    // Glyph used to draw two pixels per cell: the foreground color is the upper one, the background color the lower
+    static constexpr std::string_view upper_half_block = "\u2580";
+
+    // Chars used to draw images when the features are dropped, from the darkest to the brightest
+    static constexpr std::string_view luminance_ramp = " .:-=+*#%@";
+
+    // Minimum size of the table of the feats before the ones no longer used are dropped
+    static constexpr size_t min_feats_limit = 1024;
+
+    // Id of a feat not yet interned, when copying cells between canvases
+    static constexpr uint32_t no_feat_id = std::numeric_limits<uint32_t>::max();
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+    // with_headroom
+    /**
+     * @brief Return a capacity a quarter larger than the requested one, so that a sequence of small enlargements
+     * doesn't reallocate the canvas every time.
+     *
+     * @param n The requested capacity.
+     * @return uint32_t The capacity with headroom.
+     */
+    static uint32_t with_headroom(uint32_t n) { return n + n / 4; }
+
     //====================================================
     //     Constructors
     //====================================================
@@ -51,9 +90,28 @@ namespace osm {
      * @param height Height of the canvas.
      */
     Canvas::Canvas(uint32_t width, uint32_t height)
-        : already_drawn_(false), width_(width), height_(height), bg_char_(' '), bg_feat_(""), frame_enabled_(false) {
-        resizeCanvas();
-        clear();
+        : width_(0),
+          height_(0),
+          stride_(0),
+          drawn_height_(0),
+          resized_(false),
+          auto_resize_(false),
+          resize_count_(0),
+          bg_char_(' '),
+          bg_feat_(""),
+          feats_(1),
+          bg_feat_id_(0),
+          last_feat_id_(0),
+          feats_limit_(min_feats_limit),
+          frame_enabled_(false),
+          frame_style_(FrameStyle::EMPTY),
+          pacer_(nullptr),
+          pool_(nullptr),
+          version_(0),
+          cache_valid_(false),
+          cache_plain_(false) {
+        resize(width, height);
+        resized_ = false;
     }
 
     //====================================================
@@ -68,8 +126,11 @@ namespace osm {
      * @param feat The optional feat.
      */
     void Canvas::setBackground(char c, std::string_view feat) {
+        collectFeats();
         bg_char_ = c;
         bg_feat_ = feat;
+        bg_feat_id_ = intern(feat);
+        version_++;
     }
 
     // setFrame
@@ -82,6 +143,7 @@ namespace osm {
     void Canvas::setFrame(FrameStyle fs, std::string_view feat) {
         frame_style_ = fs;
         frame_feat_ = feat;
+        cache_valid_ = false;
     }
 
     // setWidth
@@ -90,10 +152,7 @@ namespace osm {
      *
      * @param width The canvas width to set.
      */
-    void Canvas::setWidth(uint32_t width) {
-        width_ = width;
-        resizeCanvas();
-    }
+    void Canvas::setWidth(uint32_t width) { resize(width, height_); }
 
     // setHeight
     /**
@@ -101,9 +160,44 @@ namespace osm {
      *
      * @param height The canvas height to set.
      */
-    void Canvas::setHeight(uint32_t height) {
-        height_ = height;
-        resizeCanvas();
+    void Canvas::setHeight(uint32_t height) { resize(width_, height); }
+
+    // setFramePacer
+    /**
+     * @brief Set the FramePacer used to adapt the refresh rate to the speed of the output channel. Calls to refresh
+     * are skipped until the pacer is ready, and the features of the cells are dropped when it asks for a reduced
+     * detail. Set to nullptr (default) to draw every frame.
+     *
+     * @param pacer The FramePacer, which must outlive the canvas.
+     */
+    void Canvas::setFramePacer(FramePacer *pacer) { pacer_ = pacer; }
+
+    // setThreadPool
+    /**
+     * @brief Set the ThreadPool used to encode the rows of large canvases in parallel. Each thread encodes a block of
+     * consecutive rows into its own buffer and the buffers are then joined in row order, so the output is the same of
+     * the serial encoding. Small canvases are always encoded serially. Set to nullptr (default) to disable it.
+     *
+     * @param pool The ThreadPool, which must outlive the canvas.
+     */
+    void Canvas::setThreadPool(ThreadPool *pool) { pool_ = pool; }
+
+    // enableAutoResize
+    /**
+     * @brief Flag to resize automatically the canvas to the terminal size. When enabled, each refresh checks if the
+     * terminal has been resized since the previous one and, in this case, resizes the canvas to the terminal width and
+     * to its height minus one row (the one taken by the cursor after the last line). The content is preserved.
+     *
+     * @param auto_resize Set to True to enable the automatic resize. Otherwise set to False.
+     */
+    void Canvas::enableAutoResize(bool auto_resize) {
+        auto_resize_ = auto_resize;
+        if (auto_resize_) {
+            resize_count_ = terminal_resize_count();
+
+            auto [columns, rows] = terminal_size();
+            if (columns > 0 && rows > 1) resize(columns, rows - 1);
+        }
     }
 
     //====================================================
@@ -126,6 +220,63 @@ namespace osm {
      */
     uint32_t Canvas::getHeight() const { return height_; }
 
+    // getFramePacer
+    /**
+     * @brief Get the FramePacer of the canvas.
+     *
+     * @return FramePacer* The FramePacer of the canvas, nullptr if not set.
+     */
+    FramePacer *Canvas::getFramePacer() const { return pacer_; }
+
+    // getThreadPool
+    /**
+     * @brief Get the ThreadPool of the canvas.
+     *
+     * @return ThreadPool* The ThreadPool of the canvas, nullptr if not set.
+     */
+    ThreadPool *Canvas::getThreadPool() const { return pool_; }
+
+    // isAutoResizeEnabled
+    /**
+     * @brief Return True if the automatic resize is enabled. Otherwise return False.
+     *
+     * @return bool The automatic resize flag.
+     */
+    bool Canvas::isAutoResizeEnabled() const { return auto_resize_; }
+
+    // getChar
+    /**
+     * @brief Get the char of a cell. An out-of-bounds exception will be thrown if the coordinates are outside the
+     * canvas.
+     *
+     * @param x The x position.
+     * @param y The y position.
+     * @return char The char of the cell.
+     */
+    char Canvas::getChar(uint32_t x, uint32_t y) const { return char_buffer_[checkedIndex(x, y)]; }
+
+    // getFeat
+    /**
+     * @brief Get the feat of a cell. An out-of-bounds exception will be thrown if the coordinates are outside the
+     * canvas.
+     *
+     * @param x The x position.
+     * @param y The y position.
+     * @return std::string The feat of the cell.
+     */
+    std::string Canvas::getFeat(uint32_t x, uint32_t y) const { return std::string(featOf(checkedIndex(x, y))); }
+
+    // getGlyph
+    /**
+     * @brief Get the glyph of a cell, i.e. what is printed for it: its char or the glyph put with putGlyph. An
+     * out-of-bounds exception will be thrown if the coordinates are outside the canvas.
+     *
+     * @param x The x position.
+     * @param y The y position.
+     * @return std::string The glyph of the cell.
+     */
+    std::string Canvas::getGlyph(uint32_t x, uint32_t y) const { return std::string(glyphOf(checkedIndex(x, y))); }
+
     // getBackground
     /**
      * @brief Get the char that fills the background.
@@ -169,7 +320,10 @@ namespace osm {
      *
      * @param frame_enabled Set to True to enable the frame. Otherwise set to False.
      */
-    void Canvas::enableFrame(bool frame_enabled) { frame_enabled_ = frame_enabled; }
+    void Canvas::enableFrame(bool frame_enabled) {
+        frame_enabled_ = frame_enabled;
+        cache_valid_ = false;
+    }
 
     // isFrameEnabled
     /**
@@ -184,8 +338,74 @@ namespace osm {
      * @brief Fill the canvas with the background.
      */
     void Canvas::clear() {
-        char_buffer_.assign(static_cast<int64_t>(width_) * height_, bg_char_);
-        feat_buffer_.assign(static_cast<int64_t>(width_) * height_, bg_feat_);
+        std::fill(char_buffer_.begin(), char_buffer_.end(), bg_char_);
+        std::fill(feat_buffer_.begin(), feat_buffer_.end(), bg_feat_id_);
+        std::fill(glyph_buffer_.begin(), glyph_buffer_.end(), 0);
+        version_++;
+    }
+
+    // resize
+    /**
+     * @brief Resize the canvas, preserving its content: the cells keep their coordinates, the ones which fall outside
+     * the new size are dropped and the new ones are filled with the background. The rows are stored with a stride
+     * (the row capacity) larger than the width, so the canvas is reallocated only when it grows beyond its capacity,
+     * and then with some headroom.
+     *
+     * @param width The new width.
+     * @param height The new height.
+     */
+    void Canvas::resize(uint32_t width, uint32_t height) {
+        if (width > stride_) {
+            uint32_t stride = with_headroom(width);
+            std::vector<char> chars;
+            std::vector<uint32_t> feats;
+            std::vector<uint8_t> glyphs;
+            chars.reserve(static_cast<size_t>(stride) * with_headroom(height));
+            feats.reserve(static_cast<size_t>(stride) * with_headroom(height));
+            glyphs.reserve(static_cast<size_t>(stride) * with_headroom(height));
+            chars.resize(static_cast<size_t>(stride) * height, bg_char_);
+            feats.resize(static_cast<size_t>(stride) * height, bg_feat_id_);
+            glyphs.resize(static_cast<size_t>(stride) * height, 0);
+
+            for (uint32_t y{0}; y < std::min(height, height_); y++) {
+                size_t from = index(0, y), to = static_cast<size_t>(y) * stride;
+                std::copy_n(char_buffer_.begin() + from, width_, chars.begin() + to);
+                std::copy_n(feat_buffer_.begin() + from, width_, feats.begin() + to);
+                std::copy_n(glyph_buffer_.begin() + from, width_, glyphs.begin() + to);
+            }
+
+            char_buffer_.swap(chars);
+            feat_buffer_.swap(feats);
+            glyph_buffer_.swap(glyphs);
+            stride_ = stride;
+        } else {
+            if (static_cast<size_t>(stride_) * height > char_buffer_.size()) {
+                char_buffer_.reserve(static_cast<size_t>(stride_) * with_headroom(height));
+                feat_buffer_.reserve(static_cast<size_t>(stride_) * with_headroom(height));
+                glyph_buffer_.reserve(static_cast<size_t>(stride_) * with_headroom(height));
+                char_buffer_.resize(static_cast<size_t>(stride_) * height, bg_char_);
+                feat_buffer_.resize(static_cast<size_t>(stride_) * height, bg_feat_id_);
+                glyph_buffer_.resize(static_cast<size_t>(stride_) * height, 0);
+            }
+
+            // The cells exposed by the resize may hold the content of a previous, larger, canvas
+            for (uint32_t y{0}; y < std::min(height, height_) && width > width_; y++) {
+                std::fill_n(char_buffer_.begin() + index(width_, y), width - width_, bg_char_);
+                std::fill_n(feat_buffer_.begin() + index(width_, y), width - width_, bg_feat_id_);
+                std::fill_n(glyph_buffer_.begin() + index(width_, y), width - width_, 0);
+            }
+            for (uint32_t y{height_}; y < height; y++) {
+                std::fill_n(char_buffer_.begin() + index(0, y), width, bg_char_);
+                std::fill_n(feat_buffer_.begin() + index(0, y), width, bg_feat_id_);
+                std::fill_n(glyph_buffer_.begin() + index(0, y), width, 0);
+            }
+        }
+
+        resized_ = resized_ || width != width_ || height != height_;
+        width_ = width;
+        height_ = height;
+        version_++;
+        cache_valid_ = false;
     }
 
     // put
@@ -199,79 +419,672 @@ namespace osm {
      * @param feat The optional feature.
      */
     void Canvas::put(uint32_t x, uint32_t y, char c, std::string_view feat) {
-        char_buffer_.at(y * width_ + x) = c;
-        feat_buffer_.at(y * width_ + x) = feat;
+        size_t p = checkedIndex(x, y);
+        collectFeats();
+        char_buffer_[p] = c;
+        feat_buffer_[p] = intern(feat);
+        glyph_buffer_[p] = 0;
+        version_++;
     }
 
-    // refresh
+    // putUnchecked
     /**
-     * @brief Display the canvas in the console.
+     * @brief Put a character in the canvas, as put does, but without any bounds check. It is meant for loops whose
+     * coordinates have already been clipped to the canvas: the behavior is undefined otherwise.
+     *
+     * @param x The x position.
+     * @param y The y position.
+     * @param c The char to put.
+     * @param feat The optional feature.
      */
-    void Canvas::refresh() {
-        if (already_drawn_) {
-            for (uint32_t i{0}; i < height_; i++) {
-                osm::cout << feat(crs, "up", 1);
+    void Canvas::putUnchecked(uint32_t x, uint32_t y, char c, std::string_view feat) {
+        size_t p = index(x, y);
+        collectFeats();
+        char_buffer_[p] = c;
+        feat_buffer_[p] = intern(feat);
+        glyph_buffer_[p] = 0;
+        version_++;
+    }
+
+    // putGlyph
+    /**
+     * @brief Put a glyph which is not a single char (e.g. an UTF-8 block or Braille pattern) in the canvas, given its
+     * coordinates and an optional feat. The glyph must take a single column of the terminal. An out-of-bounds exception
+     * will be thrown if the coordinates are outside the canvas.
+     *
+     * @param x The x position.
+     * @param y The y position.
+     * @param glyph The glyph to put, at most 255 bytes long.
+     * @param feat The optional feature.
+     * @param fallback The char returned by getChar for the cell and printed instead of the glyph when the features are
+     * dropped.
+     */
+    void Canvas::putGlyph(uint32_t x, uint32_t y, std::string_view glyph, std::string_view feat, char fallback) {
+        if (glyph.size() > 255) throw std::runtime_error("Canvas glyphs must be at most 255 bytes long!");
+
+        size_t p = checkedIndex(x, y);
+        collectFeats();
+        feat_key_.assign(feat).append(glyph);
+        char_buffer_[p] = fallback;
+        feat_buffer_[p] = intern(feat_key_);
+        glyph_buffer_[p] = static_cast<uint8_t>(glyph.size());
+        version_++;
+    }
+
+    // fillRect
+    /**
+     * @brief Fill a rectangle with a character and an optional feat. The rectangle is clipped to the canvas, so it can
+     * be partially (or completely) outside of it.
+     *
+     * @param x The x position of the top-left corner.
+     * @param y The y position of the top-left corner.
+     * @param w The width of the rectangle.
+     * @param h The height of the rectangle.
+     * @param c The char to fill the rectangle with.
+     * @param feat The optional feature.
+     */
+    void Canvas::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, char c, std::string_view feat) {
+        if (!clip(x, y, w, h)) return;
+
+        collectFeats();
+        const uint32_t id = intern(feat);
+        for (int32_t row = y; row < y + h; row++) {
+            size_t p = index(x, row);
+            std::fill_n(char_buffer_.begin() + p, w, c);
+            std::fill_n(feat_buffer_.begin() + p, w, id);
+            std::fill_n(glyph_buffer_.begin() + p, w, 0);
+        }
+        version_++;
+    }
+
+    // drawHLine
+    /**
+     * @brief Draw an horizontal line starting from the given position and going right. The line is clipped to the
+     * canvas.
+     *
+     * @param x The x position of the first cell.
+     * @param y The y position of the line.
+     * @param length The length of the line.
+     * @param c The char of the line.
+     * @param feat The optional feature.
+     */
+    void Canvas::drawHLine(int32_t x, int32_t y, int32_t length, char c, std::string_view feat) {
+        fillRect(x, y, length, 1, c, feat);
+    }
+
+    // drawVLine
+    /**
+     * @brief Draw a vertical line starting from the given position and going down. The line is clipped to the canvas.
+     *
+     * @param x The x position of the line.
+     * @param y The y position of the first cell.
+     * @param length The length of the line.
+     * @param c The char of the line.
+     * @param feat The optional feature.
+     */
+    void Canvas::drawVLine(int32_t x, int32_t y, int32_t length, char c, std::string_view feat) {
+        fillRect(x, y, 1, length, c, feat);
+    }
+
+    // drawText
+    /**
+     * @brief Write a single-line text starting from the given position, with an optional feat. The text is clipped to
+     * the canvas. Each UTF-8 char takes a cell, as a glyph (see putGlyph) whose fallback is '?', and the chars which
+     * take no column (e.g. combining marks) are kept in the cell of the previous one. Wide chars (e.g. CJK) take a
+     * cell too, although they take two columns of the terminal.
+     *
+     * @param x The x position of the first char.
+     * @param y The y position of the text.
+     * @param text The text to write.
+     * @param feat The optional feature.
+     */
+    void Canvas::drawText(int32_t x, int32_t y, std::string_view text, std::string_view feat) {
+        if (y < 0 || y >= static_cast<int32_t>(height_)) return;
+
+        collectFeats();
+        int64_t col = x;
+        for (size_t pos = 0; pos < text.size() && col < static_cast<int64_t>(width_); col++) {
+            // A printable ASCII char followed by another ASCII char (or by nothing) is a cell by itself
+            const auto byte = static_cast<unsigned char>(text[pos]);
+            const bool ascii_next = pos + 1 == text.size() || static_cast<unsigned char>(text[pos + 1]) < 0x80;
+            size_t length = 1;
+            if (byte < 0x20 || byte >= 0x7F || !ascii_next) {
+                length = display_prefix(text.substr(pos), 1);
+                if (length == 0) length = display_prefix(text.substr(pos), 2);
+                length = std::max<size_t>(length, 1);
+            }
+
+            if (col >= 0) {
+                size_t p = index(static_cast<uint32_t>(col), static_cast<uint32_t>(y));
+                if (length == 1) {
+                    char_buffer_[p] = text[pos];
+                    feat_buffer_[p] = intern(feat);
+                    glyph_buffer_[p] = 0;
+                } else {
+                    const std::string_view glyph = text.substr(pos, std::min<size_t>(length, 255));
+                    feat_key_.assign(feat).append(glyph);
+                    char_buffer_[p] = byte >= 0x20 && byte < 0x7F ? text[pos] : '?';
+                    feat_buffer_[p] = intern(feat_key_);
+                    glyph_buffer_[p] = static_cast<uint8_t>(glyph.size());
+                }
             }
+            pos += length;
         }
+        version_++;
+    }
 
-        uint32_t y{0};
+    // blit
+    /**
+     * @brief Copy the content of another canvas into this one, placing its top-left corner at the given position.
+     * The copied region is clipped to this canvas. The source frame, if any, is not copied.
+     *
+     * @param src The source canvas.
+     * @param x The x position of the top-left corner of the source canvas.
+     * @param y The y position of the top-left corner of the source canvas.
+     */
+    void Canvas::blit(const Canvas &src, int32_t x, int32_t y) {
+        if (&src == this) {
+            Canvas copy{src};
+            blit(copy, x, y);
+            return;
+        }
+
+        int32_t src_x = x, src_y = y;
+        int32_t w = static_cast<int32_t>(src.width_), h = static_cast<int32_t>(src.height_);
+        if (!clip(x, y, w, h)) return;
+
+        // The feats of the source are interned into this canvas once each
+        collectFeats();
+        feat_map_.assign(src.feats_.size(), no_feat_id);
+        for (int32_t row = 0; row < h; row++) {
+            size_t from = src.index(x - src_x, y + row - src_y);
+            size_t to = index(x, y + row);
+            std::copy_n(src.char_buffer_.begin() + from, w, char_buffer_.begin() + to);
+            std::copy_n(src.glyph_buffer_.begin() + from, w, glyph_buffer_.begin() + to);
+            for (size_t i = 0; i < static_cast<size_t>(w); i++) {
+                uint32_t &id = feat_map_[src.feat_buffer_[from + i]];
+                if (id == no_feat_id) id = intern(src.feats_[src.feat_buffer_[from + i]]);
+                feat_buffer_[to + i] = id;
+            }
+        }
+        version_++;
+    }
 
-        const auto &frame = [&](uint32_t fi) -> std::string {
-            return frame_feat_ + frames[frame_style_][fi] + feat(rst, "all");
+    // shift
+    /**
+     * @brief Scroll the content of the canvas by the given number of columns and rows, in place. The cells moved
+     * outside of the canvas are dropped and the exposed ones are filled with the background. It is used to pan a plot
+     * redrawing only the exposed cells.
+     *
+     * @param dx The number of columns to move the content right (left if negative).
+     * @param dy The number of rows to move the content down (up if negative).
+     */
+    void Canvas::shift(int32_t dx, int32_t dy) {
+        const auto w = static_cast<int32_t>(width_), h = static_cast<int32_t>(height_);
+        if (dx == 0 && dy == 0) return;
+        if (std::abs(dx) >= w || std::abs(dy) >= h) {
+            clear();
+            return;
+        }
+
+        // Rows (and cells within a row) are moved in the order which doesn't overwrite the ones still to be moved
+        const auto &move_cells = [this](size_t from, size_t to, size_t n) {
+            if (to > from) {
+                std::copy_backward(char_buffer_.begin() + from, char_buffer_.begin() + from + n,
+                                   char_buffer_.begin() + to + n);
+                std::copy_backward(feat_buffer_.begin() + from, feat_buffer_.begin() + from + n,
+                                   feat_buffer_.begin() + to + n);
+                std::copy_backward(glyph_buffer_.begin() + from, glyph_buffer_.begin() + from + n,
+                                   glyph_buffer_.begin() + to + n);
+            } else {
+                std::copy_n(char_buffer_.begin() + from, n, char_buffer_.begin() + to);
+                std::copy_n(feat_buffer_.begin() + from, n, feat_buffer_.begin() + to);
+                std::copy_n(glyph_buffer_.begin() + from, n, glyph_buffer_.begin() + to);
+            }
         };
+        const int32_t cols = w - std::abs(dx), rows = h - std::abs(dy);
+        for (int32_t i = 0; i < rows; i++) {
+            int32_t to_y = dy > 0 ? h - 1 - i : i;
+            move_cells(index(static_cast<uint32_t>(std::max(-dx, 0)), static_cast<uint32_t>(to_y - dy)),
+                       index(static_cast<uint32_t>(std::max(dx, 0)), static_cast<uint32_t>(to_y)),
+                       static_cast<size_t>(cols));
+        }
 
-        std::stringstream ss;
+        if (dx > 0) fillRect(0, 0, dx, h, bg_char_, bg_feat_);
+        if (dx < 0) fillRect(w + dx, 0, -dx, h, bg_char_, bg_feat_);
+        if (dy > 0) fillRect(0, 0, w, dy, bg_char_, bg_feat_);
+        if (dy < 0) fillRect(0, h + dy, w, -dy, bg_char_, bg_feat_);
+        version_++;
+    }
 
-        if (frame_enabled_) {
-            ss << frame(0);
+    // drawImage
+    /**
+     * @brief Draw an image, resized to the given number of columns and rows with a box filter. Each cell shows two
+     * vertically stacked pixels through the upper half block glyph, whose foreground color is the upper pixel and
+     * background color the lower one. The image is clipped to the canvas. When the features are dropped (see
+     * setFramePacer) the cells are drawn with chars of matching luminance.
+     *
+     * @param image The image.
+     * @param x The x position of the top-left corner.
+     * @param y The y position of the top-left corner.
+     * @param cols The number of columns taken by the image.
+     * @param rows The number of rows taken by the image.
+     * @param mode The colors used: 24-bit (default), 256 or 16.
+     * @param dither If True and mode is not TRUECOLOR, ordered dithering is applied.
+     */
+    void Canvas::drawImage(const Image &image, int32_t x, int32_t y, uint32_t cols, uint32_t rows, ColorMode mode,
+                           bool dither) {
+        int32_t cx = x, cy = y, w = static_cast<int32_t>(cols), h = static_cast<int32_t>(rows);
+        if (!clip(cx, cy, w, h)) return;
+
+        Image scaled;
+        const bool same_size = image.getWidth() == cols && image.getHeight() == 2 * rows;
+        if (!same_size) scaled = image.resized(cols, 2 * rows);
+        const uint8_t *pixels = same_size ? image.data() : scaled.data();
+        const size_t row_size = static_cast<size_t>(cols) * 3;
+
+        collectFeats();
+        std::string &cell_feat = feat_key_;
+        for (int32_t row = cy; row < cy + h; row++) {
+            auto py = static_cast<uint32_t>(2 * (row - y));
+
+            for (int32_t col = cx; col < cx + w; col++) {
+                auto px = static_cast<uint32_t>(col - x);
+                const uint8_t *upper = pixels + py * row_size + px * 3;
+                const uint8_t *lower = upper + row_size;
 
-            for (uint32_t i{2}; i < width_; i++) {
-                ss << frame(1);
+                cell_feat.clear();
+                append_color(cell_feat, upper, false, mode, dither ? dither_bias(px, py, mode) : 0);
+                append_color(cell_feat, lower, true, mode, dither ? dither_bias(px, py + 1, mode) : 0);
+                cell_feat.append(upper_half_block);
+
+                // Rec. 601 luma of the two pixels, in [0, 2 * 255 * 256]
+                uint32_t luma = 77 * (upper[0] + lower[0]) + 150 * (upper[1] + lower[1]) + 29 * (upper[2] + lower[2]);
+
+                size_t p = index(col, row);
+                char_buffer_[p] = luminance_ramp[luma * luminance_ramp.size() / (2 * 255 * 256 + 1)];
+                feat_buffer_[p] = intern(cell_feat);
+                glyph_buffer_[p] = static_cast<uint8_t>(upper_half_block.size());
             }
+        }
+        version_++;
+    }
+
+    // addLayer
+    /**
+     * @brief Add a static layer, i.e. a canvas whose content changes rarely (a grid, axes, labels...), placed over the
+     * top-left corner of this canvas. The cells of the static layers are encoded once and the encoding is reused by
+     * the following refreshes, until one of the layers is modified. Layers with a z greater or equal to 0 are drawn
+     * over the content of this canvas, the others under it (i.e. only where the content is the background). Among
+     * layers, the higher z wins and, in each layer, the cells with its background are transparent. The frame of the
+     * layers is not drawn.
+     *
+     * @param layer The layer, which must outlive the canvas (or be removed before).
+     * @param z The z-order of the layer.
+     */
+    void Canvas::addLayer(const Canvas &layer, int32_t z) {
+        if (&layer == this) throw std::runtime_error("A canvas cannot be a layer of itself!");
+
+        removeLayer(layer);
+        auto it = std::upper_bound(layers_.begin(), layers_.end(), z,
+                                   [](int32_t z, const Layer &l) { return z < l.z; });
+        layers_.insert(it, {&layer, z});
+        cache_valid_ = false;
+    }
+
+    // removeLayer
+    /**
+     * @brief Remove a static layer. Nothing is done if the layer has not been added.
+     *
+     * @param layer The layer to be removed.
+     */
+    void Canvas::removeLayer(const Canvas &layer) {
+        const auto &is_layer = [&](const Layer &l) { return l.canvas == &layer; };
+        layers_.erase(std::remove_if(layers_.begin(), layers_.end(), is_layer), layers_.end());
+        cache_valid_ = false;
+    }
+
+    // invalidateLayers
+    /**
+     * @brief Force the encoding of the static layers (and of the frame) to be rebuilt by the next refresh. Changes made
+     * through the canvas methods are detected automatically, so this is needed only after changing the objects
+     * referenced by the features.
+     *
+     */
+    void Canvas::invalidateLayers() { cache_valid_ = false; }
+
+    // refresh
+    /**
+     * @brief Display the canvas in the console. The frame is written with a single scatter-gather write if osm::cout
+     * goes straight to the standard output (see write_frame).
+     */
+    void Canvas::refresh() {
+        if (auto_resize_) autoResize();
+        updateLayers();
+        if (pacer_ && !pacer_->ready()) return;
 
-            ss << frame(2) << std::endl;
-            y++;
+        frame_.clear();
+        if (drawn_height_ > 0) {
+            frame_.copy(move_by(-static_cast<int32_t>(drawn_height_), 0));
+
+            // A smaller canvas would leave the tail of the previous one on the screen
+            if (resized_) frame_.copy(feat(tcs, "crt")).copy(feat(tcsc, "csc", 0));
         }
+        render(frame_);
+        write_frame(frame_, pacer_);
+        drawn_height_ = height_;
+        resized_ = false;
+    }
 
-        for (; y < height_; y++) {
-            if (y == height_ - 1 && frame_enabled_) {
-                ss << frame(5);
+    // render
+    /**
+     * @brief Append the encoded canvas to a FrameAssembler, without printing it. The assembler references the canvas
+     * buffers, so the canvas must not be modified until the frame is written. It can be used to write the canvas with
+     * a single writev call. The frame and the static layers are encoded only when they change.
+     *
+     * @param frame The FrameAssembler.
+     */
+    void Canvas::render(FrameAssembler &frame) const {
+        const bool plain = pacer_ && pacer_->isReducedDetail();
+        updateCache(plain);
 
-                for (uint32_t i{2}; i < width_; i++) {
-                    ss << frame(6);
-                }
+        if (!pool_ || pool_->getThreads() < 2 || static_cast<uint64_t>(width_) * height_ < parallel_threshold) {
+            renderRows(frame, 0, height_, plain);
+            return;
+        }
+
+        // Blocks of consecutive rows, encoded in parallel and joined in row order
+        const size_t blocks = std::min<size_t>(pool_->getThreads(), height_);
+        chunks_.resize(blocks);
+        pool_->run(blocks, [&](size_t i) {
+            chunks_[i].clear();
+            renderRows(chunks_[i], static_cast<uint32_t>(height_ * i / blocks),
+                       static_cast<uint32_t>(height_ * (i + 1) / blocks), plain);
+        });
+
+        for (const auto &chunk: chunks_) frame.append(chunk);
+    }
+
+    // renderRows
+    /**
+     * @brief Append the encoding of a range of rows to a FrameAssembler. The cache must be up to date.
+     *
+     * @param frame The FrameAssembler.
+     * @param first The first row.
+     * @param last The row after the last one.
+     * @param plain If True the features are not encoded.
+     */
+    void Canvas::renderRows(FrameAssembler &frame, uint32_t first, uint32_t last, bool plain) const {
+        const std::string &reset = feat(rst, "all");
+        const std::string_view pool = cache_pool_;
 
-                ss << frame(7) << std::endl;
+        for (uint32_t y{first}; y < last; y++) {
+            if (y == 0 && frame_enabled_) {
+                frame.add(frame_top_);
+                continue;
+            }
+
+            if (y == height_ - 1 && frame_enabled_) {
+                frame.add(frame_bottom_);
                 continue;
             }
 
             for (uint32_t x{0}; x < width_; x++) {
                 if (x == 0 && frame_enabled_) {
-                    ss << frame(3);
+                    frame.add(frame_left_);
                     continue;
                 }
 
                 if (x == width_ - 1 && frame_enabled_) {
-                    ss << frame(4);
+                    frame.add(frame_right_);
                     continue;
                 }
 
-                uint32_t p = y * width_ + x;
+                size_t p = index(x, y);
+
+                if (!layers_.empty()) {
+                    size_t c = static_cast<size_t>(y) * width_ + x;
+                    const CachedCell &cell = cache_above_[c].size > 0 || !isTransparent(p) ? cache_above_[c]
+                                                                                            : cache_below_[c];
+                    if (cell.size > 0) {
+                        frame.add(pool.substr(cell.offset, cell.size));
+                        continue;
+                    }
+                }
+
+                if (plain) {
+                    frame.add(std::string_view(&char_buffer_[p], 1));
+                } else if (glyph_buffer_[p] > 0) {
+                    frame.add(feats_[feat_buffer_[p]]).add(reset);
+                } else {
+                    frame.add(feats_[feat_buffer_[p]]).add(std::string_view(&char_buffer_[p], 1)).add(reset);
+                }
+            }
+            frame.add("\n");
+        }
+    }
+
+    // updateCache
+    /**
+     * @brief Encode the frame and the static layers, if they changed since the last call. Each cell of the canvas is
+     * associated to the encoding of the topmost opaque layer cell over the content and to the one under it.
+     *
+     * @param plain If True the features are not encoded.
+     */
+    void Canvas::updateCache(bool plain) const {
+        if (cache_valid_ && cache_plain_ == plain && cache_versions_.size() == layers_.size() &&
+            std::equal(layers_.begin(), layers_.end(), cache_versions_.begin(),
+                       [](const Layer &l, uint64_t version) { return l.canvas->version_ == version; })) {
+            return;
+        }
+
+        const std::string &reset = feat(rst, "all");
+        const auto &encode = [&](std::string &out, std::string_view cell_feat, std::string_view c) {
+            if (!plain) out.append(cell_feat);
+            out.append(c);
+            if (!plain) out.append(reset);
+        };
+
+        // Frame
+        const auto &border_row = [&](std::string &out, uint32_t first, uint32_t middle, uint32_t last) {
+            out.clear();
+            encode(out, frame_feat_, frames[frame_style_][first]);
+            for (uint32_t i{2}; i < width_; i++) encode(out, frame_feat_, frames[frame_style_][middle]);
+            encode(out, frame_feat_, frames[frame_style_][last]);
+            out.append("\n");
+        };
+        if (frame_enabled_) {
+            border_row(frame_top_, 0, 1, 2);
+            border_row(frame_bottom_, 5, 6, 7);
+            frame_left_.clear();
+            encode(frame_left_, frame_feat_, frames[frame_style_][3]);
+            frame_right_.clear();
+            encode(frame_right_, frame_feat_, frames[frame_style_][4]);
+        }
+
+        // Static layers
+        cache_pool_.clear();
+        cache_above_.assign(layers_.empty() ? 0 : static_cast<size_t>(width_) * height_, {0, 0});
+        cache_below_.assign(cache_above_.size(), {0, 0});
+
+        for (uint32_t y{0}; y < height_ && !layers_.empty(); y++) {
+            for (uint32_t x{0}; x < width_; x++) {
+                auto below = cache_below_.begin() + static_cast<size_t>(y) * width_ + x;
+                auto above = cache_above_.begin() + static_cast<size_t>(y) * width_ + x;
 
-                ss << feat_buffer_[p] << char_buffer_[p] << feat(rst, "all");
+                for (auto it = layers_.rbegin(); it != layers_.rend(); it++) {
+                    const Canvas &layer = *it->canvas;
+                    auto &cell = it->z >= 0 ? *above : *below;
+                    if (cell.size > 0 || x >= layer.width_ || y >= layer.height_) continue;
+
+                    size_t p = layer.index(x, y);
+                    if (layer.isTransparent(p)) continue;
+
+                    auto offset = static_cast<uint32_t>(cache_pool_.size());
+                    encode(cache_pool_, layer.featOf(p), plain ? std::string_view(&layer.char_buffer_[p], 1)
+                                                               : layer.glyphOf(p));
+                    cell = {offset, static_cast<uint32_t>(cache_pool_.size() - offset)};
+                }
             }
-            ss << std::endl;
         }
-        osm::cout << ss.str();
-        already_drawn_ = true;
+
+        cache_versions_.clear();
+        for (const auto &layer: layers_) cache_versions_.push_back(layer.canvas->version_);
+        cache_plain_ = plain;
+        cache_valid_ = true;
+    }
+
+    // isTransparent
+    /**
+     * @brief Return True if a cell holds the background, so the layers under the canvas are visible through it.
+     *
+     * @param p The position of the cell in the buffers.
+     * @return bool The transparency flag.
+     */
+    bool Canvas::isTransparent(size_t p) const {
+        return glyph_buffer_[p] == 0 && char_buffer_[p] == bg_char_ && feat_buffer_[p] == bg_feat_id_;
+    }
+
+    // glyphOf
+    /**
+     * @brief Get what is printed for a cell: its char or, if put with putGlyph, its glyph (stored at the end of the
+     * feat, so that the feat and the glyph can be written as a single fragment).
+     *
+     * @param p The position of the cell in the buffers.
+     * @return std::string_view The glyph of the cell.
+     */
+    std::string_view Canvas::glyphOf(size_t p) const {
+        if (glyph_buffer_[p] == 0) return std::string_view(&char_buffer_[p], 1);
+
+        const std::string &cell_feat = feats_[feat_buffer_[p]];
+        return std::string_view(cell_feat).substr(cell_feat.size() - glyph_buffer_[p]);
+    }
+
+    // featOf
+    /**
+     * @brief Get the feat of a cell, without its glyph.
+     *
+     * @param p The position of the cell in the buffers.
+     * @return std::string_view The feat of the cell.
+     */
+    std::string_view Canvas::featOf(size_t p) const {
+        const std::string &cell_feat = feats_[feat_buffer_[p]];
+        return std::string_view(cell_feat).substr(0, cell_feat.size() - glyph_buffer_[p]);
+    }
+
+    // intern
+    /**
+     * @brief Get the id of a feat in the table of the canvas, adding it if needed. The cells store the ids of their
+     * feats, which are expanded only when the canvas is rendered. The ids are valid until the next collectFeats.
+     *
+     * @param feat The feat (followed by the glyph, for the cells put with putGlyph).
+     * @return uint32_t The id of the feat, 0 for the empty one.
+     */
+    uint32_t Canvas::intern(std::string_view feat) {
+        if (feat.empty()) return 0;
+        if (feats_[last_feat_id_] == feat) return last_feat_id_;
+
+        if (feat_key_.data() != feat.data()) feat_key_.assign(feat);
+        auto [it, inserted] = feat_ids_.try_emplace(feat_key_, static_cast<uint32_t>(feats_.size()));
+        if (inserted) feats_.push_back(feat_key_);
+        last_feat_id_ = it->second;
+        return last_feat_id_;
+    }
+
+    // collectFeats
+    /**
+     * @brief Drop the feats no longer used by any cell from the table, if it grew too large (e.g. because of the
+     * colors of many images drawn one after the other). The ids of the feats change, so it is called only before
+     * drawing, when no id is held.
+     *
+     */
+    void Canvas::collectFeats() {
+        if (feats_.size() <= feats_limit_) return;
+
+        std::vector<uint32_t> ids(feats_.size(), no_feat_id);
+        ids[0] = 0;
+        ids[bg_feat_id_] = 0;
+        for (uint32_t id: feat_buffer_) ids[id] = 0;
+
+        std::vector<std::string> feats;
+        feat_ids_.clear();
+        for (size_t id = 0; id < ids.size(); id++) {
+            if (ids[id] == no_feat_id) continue;
+            ids[id] = static_cast<uint32_t>(feats.size());
+            if (id > 0) feat_ids_.emplace(feats_[id], ids[id]);
+            feats.push_back(std::move(feats_[id]));
+        }
+
+        for (uint32_t &id: feat_buffer_) id = ids[id];
+        bg_feat_id_ = ids[bg_feat_id_];
+        last_feat_id_ = 0;
+        feats_.swap(feats);
+        feats_limit_ = std::max(min_feats_limit, 2 * feats_.size());
+    }
+
+    // updateLayers
+    /**
+     * @brief Hook called by refresh before rendering, which derived canvases can override to update the static layers
+     * they own (e.g. the axes of a plot) when their layout changes.
+     */
+    void Canvas::updateLayers() {}
+
+    // index
+    /**
+     * @brief Get the position of a cell in the buffers.
+     *
+     * @param x The x position.
+     * @param y The y position.
+     * @return size_t The position of the cell.
+     */
+    size_t Canvas::index(uint32_t x, uint32_t y) const { return static_cast<size_t>(y) * stride_ + x; }
+
+    // checkedIndex
+    /**
+     * @brief Get the position of a cell in the buffers, checking that it lies inside the canvas.
+     *
+     * @param x The x position.
+     * @param y The y position.
+     * @return size_t The position of the cell.
+     * @throws std::out_of_range if the cell is outside the canvas.
+     */
+    size_t Canvas::checkedIndex(uint32_t x, uint32_t y) const {
+        if (x >= width_ || y >= height_) throw std::out_of_range("Canvas cell out of range!");
+
+        return index(x, y);
+    }
+
+    // clip
+    /**
+     * @brief Clip a rectangle to the canvas.
+     *
+     * @param x The x position of the top-left corner, updated to the clipped one.
+     * @param y The y position of the top-left corner, updated to the clipped one.
+     * @param w The width of the rectangle, updated to the clipped one.
+     * @param h The height of the rectangle, updated to the clipped one.
+     * @return bool False if the clipped rectangle is empty, True otherwise.
+     */
+    bool Canvas::clip(int32_t &x, int32_t &y, int32_t &w, int32_t &h) const {
+        int64_t x_end = std::min<int64_t>(static_cast<int64_t>(x) + w, width_);
+        int64_t y_end = std::min<int64_t>(static_cast<int64_t>(y) + h, height_);
+        x = std::max(x, 0);
+        y = std::max(y, 0);
+        w = static_cast<int32_t>(x_end - x);
+        h = static_cast<int32_t>(y_end - y);
+
+        return w > 0 && h > 0;
     }
 
-    // resizeCanvas
+    // autoResize
     /**
-     * @brief Resize the canvas.
+     * @brief Resize the canvas to the terminal if it has been resized since the last check.
      */
-    void Canvas::resizeCanvas() {
-        char_buffer_.resize(static_cast<int64_t>(width_) * height_);
-        feat_buffer_.resize(static_cast<int64_t>(width_) * height_);
+    void Canvas::autoResize() {
+        uint64_t count = terminal_resize_count();
+        if (count == resize_count_) return;
+        resize_count_ = count;
+
+        auto [columns, rows] = terminal_size();
+        if (columns > 0 && rows > 1) resize(columns, rows - 1);
     }
 }  // namespace osm
\ No newline at end of file
@@ -0,0 +1,357 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file image.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/graphics/image.hpp>
+
+// STD headers
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     Constants
+    //====================================================
+
+    // Default RGB values of the 16 standard colors (xterm)
+    static constexpr uint8_t standard_colors[16][3] = {
+        {0, 0, 0},       {205, 0, 0},   {0, 205, 0},   {205, 205, 0},
+        {0, 0, 238},     {205, 0, 205}, {0, 205, 205}, {229, 229, 229},
+        {127, 127, 127}, {255, 0, 0},   {0, 255, 0},   {255, 255, 0},
+        {92, 92, 255},   {255, 0, 255}, {0, 255, 255}, {255, 255, 255}};
+
+    // Levels of each channel in the xterm color cube
+    static constexpr uint8_t cube_levels[6] = {0, 95, 135, 175, 215, 255};
+
+    // 4x4 Bayer matrix used for ordered dithering
+    static constexpr int32_t bayer[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+    // Bits per channel of the lookup tables
+    static constexpr uint32_t lut_bits = 5;
+
+    //====================================================
+    //     Helper functions
+    //====================================================
+
+    // distance
+    /**
+     * @brief Squared distance between two colors.
+     *
+     */
+    static int32_t distance(int32_t r, int32_t g, int32_t b, int32_t pr, int32_t pg, int32_t pb) {
+        return (r - pr) * (r - pr) + (g - pg) * (g - pg) + (b - pb) * (b - pb);
+    }
+
+    // palette_rgb
+    /**
+     * @brief Get the RGB values of a color of the 256-color palette.
+     *
+     * @param index The index of the color.
+     * @return std::array<int32_t, 3> The RGB values.
+     */
+    std::array<int32_t, 3> palette_rgb(uint32_t index) {
+        if (index < 16) return {standard_colors[index][0], standard_colors[index][1], standard_colors[index][2]};
+        if (index >= 232) {
+            int32_t level = 8 + 10 * static_cast<int32_t>(index - 232);
+            return {level, level, level};
+        }
+
+        index -= 16;
+        return {cube_levels[index / 36], cube_levels[index / 6 % 6], cube_levels[index % 6]};
+    }
+
+    // build_lut
+    /**
+     * @brief Build the table mapping each color, with lut_bits per channel, to the nearest one of a palette.
+     *
+     * @param first The first palette index to be considered.
+     * @param last The last palette index to be considered.
+     * @return std::vector<uint8_t> The lookup table.
+     */
+    static std::vector<uint8_t> build_lut(uint32_t first, uint32_t last) {
+        constexpr uint32_t size = 1u << lut_bits, shift = 8 - lut_bits;
+        std::vector<uint8_t> lut(size * size * size);
+
+        for (uint32_t i = 0; i < lut.size(); i++) {
+            int32_t r = static_cast<int32_t>(((i >> (2 * lut_bits)) << shift) | (1u << (shift - 1)));
+            int32_t g = static_cast<int32_t>((((i >> lut_bits) & (size - 1)) << shift) | (1u << (shift - 1)));
+            int32_t b = static_cast<int32_t>(((i & (size - 1)) << shift) | (1u << (shift - 1)));
+
+            int32_t best = std::numeric_limits<int32_t>::max();
+            for (uint32_t index = first; index <= last; index++) {
+                auto color = palette_rgb(index);
+                int32_t d = distance(r, g, b, color[0], color[1], color[2]);
+                if (d < best) {
+                    best = d;
+                    lut[i] = static_cast<uint8_t>(index);
+                }
+            }
+        }
+
+        return lut;
+    }
+
+    // append_number
+    /**
+     * @brief Append the decimal representation of a small number to a string.
+     *
+     */
+    static void append_number(std::string &out, uint32_t n) {
+        char buffer[10];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), n);
+        out.append(buffer, static_cast<size_t>(result.ptr - buffer));
+    }
+
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new Image object.
+     *
+     * @param width The width in pixels.
+     * @param height The height in pixels.
+     * @param rgb The optional RGB pixels to be copied (width * height * 3 bytes). If nullptr the image is black.
+     */
+    Image::Image(uint32_t width, uint32_t height, const uint8_t *rgb)
+        : width_(width), height_(height), pixels_(static_cast<size_t>(width) * height * 3, 0) {
+        if (rgb) std::copy_n(rgb, pixels_.size(), pixels_.begin());
+    }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    // getWidth
+    /**
+     * @brief Get the width of the image.
+     *
+     * @return uint32_t The width in pixels.
+     */
+    uint32_t Image::getWidth() const { return width_; }
+
+    // getHeight
+    /**
+     * @brief Get the height of the image.
+     *
+     * @return uint32_t The height in pixels.
+     */
+    uint32_t Image::getHeight() const { return height_; }
+
+    // getPixel
+    /**
+     * @brief Get a pixel. An out-of-bounds exception will be thrown if the coordinates are outside the image.
+     *
+     * @param x The x position.
+     * @param y The y position.
+     * @return const uint8_t* The RGB values of the pixel.
+     */
+    const uint8_t *Image::getPixel(uint32_t x, uint32_t y) const {
+        if (x >= width_ || y >= height_) throw std::out_of_range("Image pixel out of range!");
+
+        return &pixels_[(static_cast<size_t>(y) * width_ + x) * 3];
+    }
+
+    // data (first overload)
+    /**
+     * @brief Get the RGB pixels.
+     *
+     * @return const uint8_t* The pixels.
+     */
+    const uint8_t *Image::data() const { return pixels_.data(); }
+
+    // data (second overload)
+    /**
+     * @brief Get the RGB pixels, to modify them.
+     *
+     * @return uint8_t* The pixels.
+     */
+    uint8_t *Image::data() { return pixels_.data(); }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // resized
+    /**
+     * @brief Return a copy of the image resized with a box filter: each pixel is the average of the source pixels it
+     * covers. The source rows of an output row are first summed into an accumulator row (a plain loop over bytes,
+     * which the compiler vectorizes) and the accumulator is then reduced horizontally.
+     *
+     * @param width The new width.
+     * @param height The new height.
+     * @return Image The resized image.
+     */
+    Image Image::resized(uint32_t width, uint32_t height) const {
+        Image out(width, height);
+        if (width_ == 0 || height_ == 0) return out;
+
+        const size_t row_size = static_cast<size_t>(width_) * 3;
+        std::vector<uint32_t> acc(row_size);
+        uint8_t *dst = out.pixels_.data();
+
+        for (uint32_t oy = 0; oy < height; oy++) {
+            auto y0 = static_cast<uint32_t>(static_cast<uint64_t>(oy) * height_ / height);
+            auto y1 = std::max(y0 + 1, static_cast<uint32_t>(static_cast<uint64_t>(oy + 1) * height_ / height));
+
+            std::fill(acc.begin(), acc.end(), 0);
+            for (uint32_t y = y0; y < y1; y++) {
+                const uint8_t *row = pixels_.data() + y * row_size;
+                uint32_t *a = acc.data();
+                for (size_t i = 0; i < row_size; i++) a[i] += row[i];
+            }
+
+            for (uint32_t ox = 0; ox < width; ox++) {
+                auto x0 = static_cast<uint32_t>(static_cast<uint64_t>(ox) * width_ / width);
+                auto x1 = std::max(x0 + 1, static_cast<uint32_t>(static_cast<uint64_t>(ox + 1) * width_ / width));
+
+                uint32_t sum[3] = {0, 0, 0};
+                for (uint32_t x = x0; x < x1; x++) {
+                    sum[0] += acc[x * 3];
+                    sum[1] += acc[x * 3 + 1];
+                    sum[2] += acc[x * 3 + 2];
+                }
+
+                uint32_t count = (x1 - x0) * (y1 - y0);
+                for (int c = 0; c < 3; c++) *dst++ = static_cast<uint8_t>((sum[c] + count / 2) / count);
+            }
+        }
+
+        return out;
+    }
+
+    // loadPPM
+    /**
+     * @brief Load a binary PPM (P6) image with 8-bit channels.
+     *
+     * @param is The input stream, opened in binary mode.
+     * @return Image The loaded image.
+     * @throws std::runtime_error if the stream doesn't contain a valid P6 image.
+     */
+    Image Image::loadPPM(std::istream &is) {
+        const auto &field = [&is]() {
+            is >> std::ws;
+            while (is.peek() == '#') {
+                is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                is >> std::ws;
+            }
+
+            uint32_t value = 0;
+            if (!(is >> value)) throw std::runtime_error("Invalid PPM header!");
+            return value;
+        };
+
+        std::string magic;
+        if (!(is >> magic) || magic != "P6") throw std::runtime_error("Only binary (P6) PPM images are supported!");
+
+        uint32_t width = field(), height = field(), max_value = field();
+        if (max_value == 0 || max_value > 255) throw std::runtime_error("Only 8-bit PPM images are supported!");
+        is.get();
+
+        Image image(width, height);
+        is.read(reinterpret_cast<char *>(image.pixels_.data()), static_cast<std::streamsize>(image.pixels_.size()));
+        if (static_cast<size_t>(is.gcount()) != image.pixels_.size()) throw std::runtime_error("Truncated PPM image!");
+
+        if (max_value != 255) {
+            for (auto &p: image.pixels_) p = static_cast<uint8_t>(std::min<uint32_t>(p, max_value) * 255 / max_value);
+        }
+
+        return image;
+    }
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+    // nearest_color
+    /**
+     * @brief Get the palette index of the color nearest to the given one, through a precomputed lookup table.
+     *
+     * @param r The r singlet of the color.
+     * @param g The g singlet of the color.
+     * @param b The b singlet of the color.
+     * @param mode COLOR256 (indexes from 16 to 255) or COLOR16 (indexes from 0 to 15).
+     * @return uint8_t The palette index.
+     */
+    uint8_t nearest_color(uint8_t r, uint8_t g, uint8_t b, ColorMode mode) {
+        static const std::vector<uint8_t> lut_256 = build_lut(16, 255);
+        static const std::vector<uint8_t> lut_16 = build_lut(0, 15);
+
+        constexpr uint32_t shift = 8 - lut_bits;
+        uint32_t i = ((r >> shift) << (2 * lut_bits)) | ((g >> shift) << lut_bits) | (b >> shift);
+
+        return mode == COLOR16 ? lut_16[i] : lut_256[i];
+    }
+
+    // dither_bias
+    /**
+     * @brief Get the ordered dithering bias of a pixel, to be added to each channel before choosing the nearest
+     * palette color. It is proportional to the distance between the palette levels.
+     *
+     * @param x The x position of the pixel.
+     * @param y The y position of the pixel.
+     * @param mode The color mode.
+     * @return int32_t The bias, 0 with TRUECOLOR.
+     */
+    int32_t dither_bias(uint32_t x, uint32_t y, ColorMode mode) {
+        const int32_t spread = mode == COLOR16 ? 128 : mode == COLOR256 ? 40 : 0;
+
+        return (2 * bayer[y & 3][x & 3] - 15) * spread / 32;
+    }
+
+    // append_color
+    /**
+     * @brief Append the escape sequence setting the foreground or background color of a pixel to a string.
+     *
+     * @param out The string.
+     * @param rgb The RGB values of the pixel.
+     * @param background If True the background color is set, otherwise the foreground one.
+     * @param mode The color mode.
+     * @param bias The optional dithering bias added to each channel.
+     */
+    void append_color(std::string &out, const uint8_t *rgb, bool background, ColorMode mode, int32_t bias) {
+        if (mode == TRUECOLOR) {
+            out.append(background ? "\x1b[48;2;" : "\x1b[38;2;");
+            append_number(out, rgb[0]);
+            out.push_back(';');
+            append_number(out, rgb[1]);
+            out.push_back(';');
+            append_number(out, rgb[2]);
+            out.push_back('m');
+            return;
+        }
+
+        const auto &channel = [bias](uint8_t v) { return static_cast<uint8_t>(std::clamp(v + bias, 0, 255)); };
+        uint8_t index = nearest_color(channel(rgb[0]), channel(rgb[1]), channel(rgb[2]), mode);
+
+        out.append("\x1b[");
+        if (mode == COLOR16) {
+            append_number(out, (background ? 40u : 30u) + (index < 8 ? index : 60u + index - 8));
+        } else {
+            out.append(background ? "48;5;" : "38;5;");
+            append_number(out, index);
+        }
+        out.push_back('m');
+    }
+}  // namespace osm
@@ -16,12 +16,55 @@
 // My headers
 #include <osmanip/graphics/canvas.hpp>
 #include <osmanip/graphics/plot_2D.hpp>
+#include <osmanip/utility/thread_pool.hpp>
 
 // STD headers
 #include <stdint.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
 namespace osm {
 
+    //====================================================
+    //     Constants
+    //====================================================
+
+    // Minimum number of columns and rows between two ticks
+    static constexpr int64_t x_tick_spacing = 8;
+    static constexpr int64_t y_tick_spacing = 3;
+
+    // Chars of the density palette, from the sparsest to the densest cells
+    static constexpr std::string_view density_palette = ".:-=+*#%@";
+
+    // Bits of the Braille dots, indexed by row and column of the dot into the cell
+    static constexpr uint8_t braille_dots[4][2] = {{0x01, 0x08}, {0x02, 0x10}, {0x04, 0x20}, {0x40, 0x80}};
+
+    // Minimum number of points binned in parallel, if the canvas has a ThreadPool
+    static constexpr size_t density_parallel_threshold = 1 << 16;
+
+    // Blocks of columns per thread of the ThreadPool when evaluating a function in parallel, to balance their costs
+    static constexpr size_t parallel_blocks_per_thread = 4;
+
+    // Distance in columns between the first samples of the adaptive sampling, and minimum distance between two samples
+    static constexpr double adaptive_initial_step = 4;
+    static constexpr double adaptive_min_step = 0.125;
+
+    // Evaluations per column allowed to the adaptive sampling if no budget is set
+    static constexpr size_t adaptive_default_budget = 8;
+
+    // Maximum distance, in columns, between a cached sample and the point where it is reused
+    static constexpr double sample_tolerance = 0.01;
+
     //====================================================
     //     Constructors
     //====================================================
@@ -35,7 +78,97 @@ namespace osm {
      * @param height Height of the canvas.
      */
     Plot2DCanvas::Plot2DCanvas(uint32_t w, uint32_t h)
-        : Canvas(w, h), offset_x_(0), offset_y_(0), scale_x_(1), scale_y_(1) {}
+        : Canvas(w, h),
+          offset_x_(0),
+          offset_y_(0),
+          scale_x_(1),
+          scale_y_(1),
+          axes_enabled_(false),
+          axes_feat_(""),
+          axes_(w, h),
+          axes_layout_(),
+          axes_valid_(false),
+          series_(),
+          auto_scale_(true),
+          min_x_(std::numeric_limits<float>::infinity()),
+          max_x_(-std::numeric_limits<float>::infinity()),
+          min_y_(std::numeric_limits<float>::infinity()),
+          max_y_(-std::numeric_limits<float>::infinity()),
+          bins_(),
+          sampling_budget_(0),
+          functions_(),
+          samples_(),
+          pending_() {}
+
+    // Copy constructor
+    /**
+     * @brief Construct a new Plot2DCanvas object as a copy of another one. The copy draws its own axes.
+     *
+     * @param other The copied canvas.
+     */
+    Plot2DCanvas::Plot2DCanvas(const Plot2DCanvas &other)
+        : Canvas(other),
+          offset_x_(other.offset_x_),
+          offset_y_(other.offset_y_),
+          scale_x_(other.scale_x_),
+          scale_y_(other.scale_y_),
+          axes_enabled_(other.axes_enabled_),
+          axes_feat_(other.axes_feat_),
+          axes_(other.axes_),
+          axes_layout_(other.axes_layout_),
+          axes_valid_(other.axes_valid_),
+          series_(other.series_),
+          auto_scale_(other.auto_scale_),
+          min_x_(other.min_x_),
+          max_x_(other.max_x_),
+          min_y_(other.min_y_),
+          max_y_(other.max_y_),
+          bins_(),
+          sampling_budget_(other.sampling_budget_),
+          functions_(other.functions_),
+          samples_(),
+          pending_() {
+        removeLayer(other.axes_);
+        if (axes_enabled_) addLayer(axes_, -1);
+    }
+
+    //====================================================
+    //     Operators
+    //====================================================
+
+    // Copy assignment
+    /**
+     * @brief Copy another canvas into this one. The copy draws its own axes.
+     *
+     * @param other The copied canvas.
+     * @return Plot2DCanvas& The canvas itself.
+     */
+    Plot2DCanvas &Plot2DCanvas::operator=(const Plot2DCanvas &other) {
+        if (this == &other) return *this;
+
+        Canvas::operator=(other);
+        offset_x_ = other.offset_x_;
+        offset_y_ = other.offset_y_;
+        scale_x_ = other.scale_x_;
+        scale_y_ = other.scale_y_;
+        axes_enabled_ = other.axes_enabled_;
+        axes_feat_ = other.axes_feat_;
+        axes_ = other.axes_;
+        axes_layout_ = other.axes_layout_;
+        axes_valid_ = other.axes_valid_;
+        series_ = other.series_;
+        auto_scale_ = other.auto_scale_;
+        min_x_ = other.min_x_;
+        max_x_ = other.max_x_;
+        min_y_ = other.min_y_;
+        max_y_ = other.max_y_;
+        sampling_budget_ = other.sampling_budget_;
+        functions_ = other.functions_;
+        removeLayer(other.axes_);
+        if (axes_enabled_) addLayer(axes_, -1);
+
+        return *this;
+    }
 
     //====================================================
     //     Setters
@@ -65,6 +198,46 @@ namespace osm {
         scale_y_ = yScale;
     }
 
+    // enableAxes
+    /**
+     * @brief Flag to draw or not the axes, with ticks and labels. The axes are drawn under the plotted functions.
+     *
+     * @param axes_enabled Set to True to enable the axes. Otherwise set to False.
+     */
+    void Plot2DCanvas::enableAxes(bool axes_enabled) {
+        axes_enabled_ = axes_enabled;
+        axes_valid_ = false;
+    }
+
+    // setAxesFeat
+    /**
+     * @brief Set the feat of the axes, ticks and labels.
+     *
+     * @param feat The feat of the axes.
+     */
+    void Plot2DCanvas::setAxesFeat(std::string_view feat) {
+        axes_feat_ = feat;
+        axes_valid_ = false;
+    }
+
+    // enableAutoScale
+    /**
+     * @brief Flag to compute or not the offset and the scale from the bounds of the series each time they are drawn.
+     * It is enabled by default.
+     *
+     * @param auto_scale Set to True to enable the auto-scaling. Otherwise set to False.
+     */
+    void Plot2DCanvas::enableAutoScale(bool auto_scale) { auto_scale_ = auto_scale; }
+
+    // setSamplingBudget
+    /**
+     * @brief Set the maximum number of evaluations of a function plotted with drawAdaptive. Set to 0 to allow 8
+     * evaluations per column. Both ends of the plot are always evaluated, so a budget lower than 2 is taken as 2.
+     *
+     * @param budget The evaluation budget.
+     */
+    void Plot2DCanvas::setSamplingBudget(size_t budget) { sampling_budget_ = budget; }
+
     //====================================================
     //     Getters
     //====================================================
@@ -100,4 +273,753 @@ namespace osm {
      * @return The scale_y of the canvas.
      */
     float Plot2DCanvas::getScaleY() const { return scale_y_; }
+
+    // isAxesEnabled
+    /**
+     * @brief Return True if the axes are enabled. Otherwise return False.
+     *
+     * @return bool The axes enabled flag.
+     */
+    bool Plot2DCanvas::isAxesEnabled() const { return axes_enabled_; }
+
+    // getAxesFeat
+    /**
+     * @brief Get the feat of the axes.
+     *
+     * @return std::string The feat of the axes.
+     */
+    std::string Plot2DCanvas::getAxesFeat() const { return axes_feat_; }
+
+    // getAxes
+    /**
+     * @brief Get the layer where the axes are drawn.
+     *
+     * @return const Canvas& The axes layer.
+     */
+    const Canvas &Plot2DCanvas::getAxes() const { return axes_; }
+
+    // isAutoScaleEnabled
+    /**
+     * @brief Return True if the auto-scaling is enabled. Otherwise return False.
+     *
+     * @return bool The auto-scaling enabled flag.
+     */
+    bool Plot2DCanvas::isAutoScaleEnabled() const { return auto_scale_; }
+
+    // getSeries
+    /**
+     * @brief Get the number of series.
+     *
+     * @return size_t The number of series.
+     */
+    size_t Plot2DCanvas::getSeries() const { return series_.size(); }
+
+    // getPoints
+    /**
+     * @brief Get the number of points of a series.
+     *
+     * @param series The id of the series.
+     * @return size_t The number of points.
+     * @throws std::out_of_range if the series doesn't exist.
+     */
+    size_t Plot2DCanvas::getPoints(size_t series) const { return series_.at(series).xs.size(); }
+
+    // getMinX
+    /**
+     * @brief Get the minimum x of the points of all the series (+infinity if there are no points).
+     *
+     * @return float The minimum x.
+     */
+    float Plot2DCanvas::getMinX() const { return min_x_; }
+
+    // getMaxX
+    /**
+     * @brief Get the maximum x of the points of all the series (-infinity if there are no points).
+     *
+     * @return float The maximum x.
+     */
+    float Plot2DCanvas::getMaxX() const { return max_x_; }
+
+    // getMinY
+    /**
+     * @brief Get the minimum y of the points of all the series (+infinity if there are no points).
+     *
+     * @return float The minimum y.
+     */
+    float Plot2DCanvas::getMinY() const { return min_y_; }
+
+    // getMaxY
+    /**
+     * @brief Get the maximum y of the points of all the series (-infinity if there are no points).
+     *
+     * @return float The maximum y.
+     */
+    float Plot2DCanvas::getMaxY() const { return max_y_; }
+
+    // getSamplingBudget
+    /**
+     * @brief Get the evaluation budget of drawAdaptive.
+     *
+     * @return size_t The evaluation budget, 0 if it depends on the width of the canvas.
+     */
+    size_t Plot2DCanvas::getSamplingBudget() const { return sampling_budget_; }
+
+    // getFunctions
+    /**
+     * @brief Get the number of functions added with addFunction.
+     *
+     * @return size_t The number of functions.
+     */
+    size_t Plot2DCanvas::getFunctions() const { return functions_.size(); }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // updateAxes
+    /**
+     * @brief Draw the axes, ticks and labels into their layer. The layout is computed only if the offset, the scale,
+     * the size or the style changed since the last call, otherwise the layer (and its encoding, which the canvas
+     * caches) is reused. It is called by refresh, so it is needed only to render the canvas in other ways.
+     *
+     * The x axis is drawn at y = 0 (or on the last row if 0 is not visible) and the y axis at x = 0 (or on the first
+     * column). Ticks are placed at "nice" values, i.e. multiples of 1, 2 or 5 times a power of 10.
+     */
+    void Plot2DCanvas::updateAxes() {
+        AxesLayout layout{offset_x_, offset_y_, scale_x_, scale_y_, width_, height_, isFrameEnabled(),
+                          getBackgroundFeat()};
+        const auto &key = [](const AxesLayout &l) {
+            return std::tie(l.offset_x, l.offset_y, l.scale_x, l.scale_y, l.width, l.height, l.frame_enabled,
+                            l.bg_feat);
+        };
+        if (axes_valid_ && key(layout) == key(axes_layout_)) return;
+
+        axes_layout_ = layout;
+        axes_valid_ = true;
+        axes_.resize(width_, height_);
+        axes_.clear();
+
+        // The layer is attached only when needed, so plots without axes don't pay for it
+        if (axes_enabled_) {
+            addLayer(axes_, -1);
+        } else {
+            removeLayer(axes_);
+        }
+
+        // Drawable area, excluding the frame
+        const int64_t border = isFrameEnabled() ? 1 : 0;
+        const int64_t c0 = border, c1 = static_cast<int64_t>(width_) - 1 - border;
+        const int64_t r0 = border, r1 = static_cast<int64_t>(height_) - 1 - border;
+        if (!axes_enabled_ || c1 < c0 || r1 < r0 || scale_x_ == 0 || scale_y_ == 0) return;
+
+        const std::string feat = layout.bg_feat + axes_feat_;
+        const auto &column = [&](double x) { return std::lround((x - offset_x_) / scale_x_); };
+        const auto &row = [&](double y) { return std::lround((y - offset_y_) / scale_y_); };
+
+        // Visible ranges
+        double x_lo = offset_x_ + c0 * scale_x_, x_hi = offset_x_ + c1 * scale_x_;
+        double y_lo = offset_y_ + r0 * scale_y_, y_hi = offset_y_ + r1 * scale_y_;
+        if (x_lo > x_hi) std::swap(x_lo, x_hi);
+        if (y_lo > y_hi) std::swap(y_lo, y_hi);
+
+        // Axes
+        const int64_t axis_col = x_lo <= 0 && 0 <= x_hi ? std::clamp(column(0), c0, c1) : c0;
+        const int64_t axis_row = y_lo <= 0 && 0 <= y_hi ? std::clamp(row(0), r0, r1) : r1;
+        const int64_t label_row = axis_row < r1 ? axis_row + 1 : axis_row - 1;
+
+        axes_.drawHLine(static_cast<int32_t>(c0), static_cast<int32_t>(axis_row), static_cast<int32_t>(c1 - c0 + 1),
+                        '-', feat);
+        axes_.drawVLine(static_cast<int32_t>(axis_col), static_cast<int32_t>(r0), static_cast<int32_t>(r1 - r0 + 1),
+                        '|', feat);
+        axes_.put(static_cast<uint32_t>(axis_col), static_cast<uint32_t>(axis_row), '+', feat);
+
+        // Calls tick(value, step) for each tick in [lo, hi], with at most max_ticks ticks
+        const auto &for_each_tick = [](double lo, double hi, int64_t max_ticks, const auto &tick) {
+            if (hi <= lo) return;
+            double step = nice_number(nice_number(hi - lo, false) / std::max<int64_t>(max_ticks - 1, 1), true);
+            for (auto i = static_cast<int64_t>(std::ceil(lo / step)); i * step <= hi + step * 1e-9; i++) {
+                tick(i * step, step);
+            }
+        };
+
+        // x ticks and labels, skipping the labels which would overlap
+        int64_t last_label_end = c0 - 2;
+        for_each_tick(x_lo, x_hi, (c1 - c0 + 1) / x_tick_spacing + 1, [&](double value, double step) {
+            int64_t col = column(value);
+            if (col < c0 || col > c1) return;
+            if (col != axis_col) axes_.put(static_cast<uint32_t>(col), static_cast<uint32_t>(axis_row), '+', feat);
+
+            std::string label = format_tick(value, step);
+            int64_t start = col - static_cast<int64_t>(label.size()) / 2;
+            int64_t end = start + static_cast<int64_t>(label.size()) - 1;
+            if (label_row < r0 || start < c0 || end > c1 || start <= last_label_end + 1) return;
+            if (col == axis_col) return;
+
+            axes_.drawText(static_cast<int32_t>(start), static_cast<int32_t>(label_row), label, feat);
+            last_label_end = end;
+        });
+
+        // y ticks and labels, right of the axis if they fit, left otherwise
+        for_each_tick(y_lo, y_hi, (r1 - r0 + 1) / y_tick_spacing + 1, [&](double value, double step) {
+            int64_t r = row(value);
+            if (r < r0 || r > r1 || r == axis_row) return;
+            axes_.put(static_cast<uint32_t>(axis_col), static_cast<uint32_t>(r), '+', feat);
+
+            if (r == label_row) return;
+            std::string label = format_tick(value, step);
+            auto size = static_cast<int64_t>(label.size());
+            int64_t start = axis_col + 1 + size - 1 <= c1 ? axis_col + 1 : axis_col - size;
+            if (start < c0) return;
+
+            axes_.drawText(static_cast<int32_t>(start), static_cast<int32_t>(r), label, feat);
+        });
+    }
+
+    // addSeries
+    /**
+     * @brief Add an empty series of points, drawn with its own char and feat.
+     *
+     * @param c The char used to draw the points.
+     * @param feat The feat used to draw the points.
+     * @return size_t The id of the series, to be passed to addPoint.
+     */
+    size_t Plot2DCanvas::addSeries(char c, std::string_view feat) {
+        series_.push_back({c, std::string(feat), {}, {}});
+
+        return series_.size() - 1;
+    }
+
+    // addPoint
+    /**
+     * @brief Add a point to a series. The bounds of the plot are updated as the points arrive, so the auto-scaling
+     * never needs to scan the data again. Points with non-finite coordinates are stored but don't move the bounds and
+     * are never drawn.
+     *
+     * @param series The id of the series.
+     * @param x The x coordinate of the point.
+     * @param y The y coordinate of the point.
+     * @throws std::out_of_range if the series doesn't exist.
+     */
+    void Plot2DCanvas::addPoint(size_t series, float x, float y) {
+        auto &s = series_.at(series);
+        s.xs.push_back(x);
+        s.ys.push_back(y);
+        extendBounds(x, y);
+    }
+
+    // addPoints
+    /**
+     * @brief Add a batch of points to a series. It is the same as calling addPoint for each point, but the storage is
+     * grown only once.
+     *
+     * @param series The id of the series.
+     * @param xs The x coordinates of the points.
+     * @param ys The y coordinates of the points.
+     * @throws std::out_of_range if the series doesn't exist.
+     * @throws std::runtime_error if xs and ys have different sizes.
+     */
+    void Plot2DCanvas::addPoints(size_t series, const std::vector<float> &xs, const std::vector<float> &ys) {
+        if (xs.size() != ys.size()) throw std::runtime_error("The x and y coordinates must have the same size!");
+
+        auto &s = series_.at(series);
+        s.xs.reserve(s.xs.size() + xs.size());
+        s.ys.reserve(s.ys.size() + ys.size());
+        for (size_t i = 0; i < xs.size(); i++) addPoint(series, xs[i], ys[i]);
+    }
+
+    // clearSeries
+    /**
+     * @brief Remove all the series and reset the bounds.
+     *
+     */
+    void Plot2DCanvas::clearSeries() {
+        series_.clear();
+        min_x_ = min_y_ = std::numeric_limits<float>::infinity();
+        max_x_ = max_y_ = -std::numeric_limits<float>::infinity();
+    }
+
+    // autoScale
+    /**
+     * @brief Set the offset and the scale so that the bounds of the series fill the drawable area, with y growing
+     * upwards. A range of zero width is centered into a range of width 1. Nothing is done if there are no points.
+     *
+     */
+    void Plot2DCanvas::autoScale() {
+        if (min_x_ > max_x_) return;
+
+        const int64_t border = isFrameEnabled() ? 1 : 0;
+        const int64_t c0 = border, c1 = static_cast<int64_t>(width_) - 1 - border;
+        const int64_t r0 = border, r1 = static_cast<int64_t>(height_) - 1 - border;
+
+        const auto &span = [](float &lo, float &hi) {
+            if (hi > lo) return;
+            lo -= 0.5f;
+            hi += 0.5f;
+        };
+        float x_lo = min_x_, x_hi = max_x_, y_lo = min_y_, y_hi = max_y_;
+        span(x_lo, x_hi);
+        span(y_lo, y_hi);
+
+        scale_x_ = (x_hi - x_lo) / static_cast<float>(std::max<int64_t>(c1 - c0, 1));
+        scale_y_ = -(y_hi - y_lo) / static_cast<float>(std::max<int64_t>(r1 - r0, 1));
+        offset_x_ = x_lo - static_cast<float>(c0) * scale_x_;
+        offset_y_ = y_hi - static_cast<float>(r0) * scale_y_;
+    }
+
+    // drawSeries
+    /**
+     * @brief Draw the points of all the series, in the order they were added, after auto-scaling the plot if enabled.
+     * Points outside of the drawable area are skipped.
+     *
+     */
+    void Plot2DCanvas::drawSeries() {
+        if (auto_scale_) autoScale();
+        if (scale_x_ == 0 || scale_y_ == 0) return;
+
+        const int64_t border = isFrameEnabled() ? 1 : 0;
+        const int64_t c0 = border, c1 = static_cast<int64_t>(width_) - 1 - border;
+        const int64_t r0 = border, r1 = static_cast<int64_t>(height_) - 1 - border;
+        const float inv_x = 1 / scale_x_, inv_y = 1 / scale_y_;
+
+        for (const auto &s: series_) {
+            for (size_t i = 0; i < s.xs.size(); i++) {
+                if (!std::isfinite(s.xs[i]) || !std::isfinite(s.ys[i])) continue;
+
+                int64_t col = std::lround((s.xs[i] - offset_x_) * inv_x);
+                int64_t r = std::lround((s.ys[i] - offset_y_) * inv_y);
+                if (col < c0 || col > c1 || r < r0 || r > r1) continue;
+
+                putUnchecked(static_cast<uint32_t>(col), static_cast<uint32_t>(r), s.c, s.feat);
+            }
+        }
+    }
+
+    // drawDensity
+    /**
+     * @brief Draw a density scatter plot of a set of points. The points are counted into a grid with a cell (or, with
+     * Braille dots, a dot) per point of the canvas, then the grid is drawn in a single pass: with the palette each
+     * non-empty cell gets a char from '.' (one point) to '@' (the densest cells), in logarithmic scale, with
+     * Braille dots each non-empty dot is set. If the auto-scaling is enabled the points extend the bounds of the plot
+     * first. If the canvas has a ThreadPool, large sets of points are counted in parallel, each thread into its own
+     * grid, and the grids are then summed.
+     *
+     * @param xs The x coordinates of the points.
+     * @param ys The y coordinates of the points.
+     * @param style The style of the plot.
+     * @param feat The feat used to draw the plot.
+     * @throws std::runtime_error if xs and ys have different sizes.
+     */
+    void Plot2DCanvas::drawDensity(const std::vector<float> &xs, const std::vector<float> &ys, DensityStyle style,
+                                   std::string_view feat) {
+        if (xs.size() != ys.size()) throw std::runtime_error("The x and y coordinates must have the same size!");
+
+        if (auto_scale_) {
+            for (size_t i = 0; i < xs.size(); i++) extendBounds(xs[i], ys[i]);
+            autoScale();
+        }
+
+        const int64_t border = isFrameEnabled() ? 1 : 0;
+        const int64_t c0 = border, c1 = static_cast<int64_t>(width_) - 1 - border;
+        const int64_t r0 = border, r1 = static_cast<int64_t>(height_) - 1 - border;
+        if (c1 < c0 || r1 < r0 || scale_x_ == 0 || scale_y_ == 0) return;
+
+        // Grid coordinates are floor(x * ax + bx) and floor(y * ay + by), a cell covering +-0.5 around its point
+        const int64_t sub_x = style == DensityStyle::BRAILLE ? 2 : 1, sub_y = style == DensityStyle::BRAILLE ? 4 : 1;
+        const int64_t grid_w = (c1 - c0 + 1) * sub_x, grid_h = (r1 - r0 + 1) * sub_y;
+        const double ax = sub_x / static_cast<double>(scale_x_), ay = sub_y / static_cast<double>(scale_y_);
+        const double bx = (0.5 - c0) * sub_x - offset_x_ * ax, by = (0.5 - r0) * sub_y - offset_y_ * ay;
+        const auto cells = static_cast<size_t>(grid_w * grid_h);
+
+        ThreadPool *pool = getThreadPool();
+        const size_t blocks = pool && xs.size() >= density_parallel_threshold ? pool->getThreads() : 1;
+        if (bins_.size() < blocks) bins_.resize(blocks);
+
+        const auto &bin = [&](size_t block) {
+            auto &grid = bins_[block];
+            grid.assign(cells, 0);
+
+            const size_t first = xs.size() * block / blocks, last = xs.size() * (block + 1) / blocks;
+            for (size_t i = first; i < last; i++) {
+                double gx = xs[i] * ax + bx, gy = ys[i] * ay + by;
+                if (!(gx >= 0 && gx < grid_w && gy >= 0 && gy < grid_h)) continue;  // Also skips NaNs
+
+                // Truncation is the same as floor here, since the coordinates are not negative
+                grid[static_cast<size_t>(gy) * static_cast<size_t>(grid_w) + static_cast<size_t>(gx)]++;
+            }
+        };
+        if (blocks > 1) {
+            pool->run(blocks, bin);
+        } else {
+            bin(0);
+        }
+
+        auto &grid = bins_[0];
+        for (size_t block = 1; block < blocks; block++) {
+            for (size_t k = 0; k < cells; k++) grid[k] += bins_[block][k];
+        }
+
+        // Draw the grid
+        if (style == DensityStyle::BRAILLE) {
+            for (int64_t r = 0; r <= r1 - r0; r++) {
+                for (int64_t col = 0; col <= c1 - c0; col++) {
+                    uint8_t bits = 0;
+                    int dots = 0;
+                    for (int64_t dy = 0; dy < 4; dy++) {
+                        for (int64_t dx = 0; dx < 2; dx++) {
+                            if (grid[static_cast<size_t>((r * 4 + dy) * grid_w + col * 2 + dx)] == 0) continue;
+                            bits |= braille_dots[dy][dx];
+                            dots++;
+                        }
+                    }
+                    if (dots == 0) continue;
+
+                    // U+2800 + bits, encoded in UTF-8
+                    const char glyph[3] = {'\xE2', static_cast<char>(0xA0 | (bits >> 6)),
+                                           static_cast<char>(0x80 | (bits & 0x3F))};
+                    putGlyph(static_cast<uint32_t>(c0 + col), static_cast<uint32_t>(r0 + r), std::string_view(glyph, 3),
+                             feat, density_palette[static_cast<size_t>(dots - 1)]);
+                }
+            }
+            return;
+        }
+
+        const uint32_t max_count = *std::max_element(grid.begin(), grid.end());
+        const double log_max = std::log(static_cast<double>(max_count));
+        const size_t top = density_palette.size() - 1;
+        for (int64_t r = 0; r <= r1 - r0; r++) {
+            for (int64_t col = 0; col <= c1 - c0; col++) {
+                uint32_t count = grid[static_cast<size_t>(r * grid_w + col)];
+                if (count == 0) continue;
+
+                // When every cell holds one point (log_max == 0) they are all drawn as single points
+                size_t level = log_max > 0 ? static_cast<size_t>(std::log(static_cast<double>(count)) / log_max *
+                                                                 static_cast<double>(top))
+                                           : 0;
+                putUnchecked(static_cast<uint32_t>(c0 + col), static_cast<uint32_t>(r0 + r),
+                             density_palette[std::min(level, top)], feat);
+            }
+        }
+    }
+
+    // drawAdaptive
+    /**
+     * @brief Plot a function sampling it adaptively, for functions which are expensive to evaluate. The function is
+     * first evaluated every 4 columns (or less often, so that these samples take at most half of the evaluation
+     * budget), then each interval whose ends are more than a row apart (or where the function
+     * stops being finite) is halved, breadth first, until it is smaller than 1/8 of a column or the evaluation budget
+     * is spent. Flat regions thus cost few evaluations and steep ones are sampled more than once per column. The
+     * intervals whose ends are at most a row apart are drawn by linear interpolation, the others only at their ends.
+     * Features narrower than the first step which don't show up in the first samples can be missed.
+     *
+     * @param function The function to be plotted.
+     * @param c The char used to draw the function.
+     * @param feat The feat used to draw the function.
+     * @return size_t The number of evaluations of the function.
+     */
+    size_t Plot2DCanvas::drawAdaptive(const std::function<double(double)> &function, char c, std::string_view feat) {
+        const int64_t border = isFrameEnabled() ? 1 : 0;
+        const int64_t c0 = border, c1 = static_cast<int64_t>(width_) - 1 - border;
+        const int64_t r0 = border, r1 = static_cast<int64_t>(height_) - 1 - border;
+        if (c1 < c0 || r1 < r0 || scale_x_ == 0 || scale_y_ == 0) return 0;
+
+        const size_t budget =
+            sampling_budget_ > 0 ? sampling_budget_ : static_cast<size_t>(c1 - c0 + 1) * adaptive_default_budget;
+        size_t evaluations = 0;
+
+        // Samples are in canvas coordinates: u is the column and v the row, both fractional
+        struct Sample {
+                double u, v;
+        };
+        const auto &sample = [&](double u) {
+            evaluations++;
+            return Sample{u, (function(offset_x_ + u * scale_x_) - offset_y_) / scale_y_};
+        };
+        const auto &plot = [&](double u, double v) {
+            if (!(v > r0 - 0.5 && v < r1 + 0.5)) return;  // Also skips NaNs
+            putUnchecked(static_cast<uint32_t>(std::lround(u)), static_cast<uint32_t>(std::lround(v)), c, feat);
+        };
+
+        // The first pass takes at most half of the budget, so that a small budget is not spent on it alone
+        const double first_samples = static_cast<double>(std::max<size_t>(1, budget / 2));
+        const double step = std::max(adaptive_initial_step, static_cast<double>(c1 - c0) / first_samples);
+
+        std::deque<std::pair<Sample, Sample>> intervals;
+        Sample last = sample(static_cast<double>(c0));
+        for (double u = c0 + step; last.u < c1; u += step) {
+            Sample next = sample(std::min(u, static_cast<double>(c1)));
+            intervals.emplace_back(last, next);
+            last = next;
+        }
+        plot(last.u, last.v);
+
+        while (!intervals.empty()) {
+            auto [a, b] = intervals.front();
+            intervals.pop_front();
+
+            const bool finite = std::isfinite(a.v) && std::isfinite(b.v);
+            const bool resolved = finite && std::abs(b.v - a.v) <= 1;
+            const bool refine = finite ? !resolved : std::isfinite(a.v) || std::isfinite(b.v);
+            if (refine && b.u - a.u > adaptive_min_step && evaluations < budget) {
+                Sample m = sample((a.u + b.u) / 2);
+                intervals.emplace_back(a, m);
+                intervals.emplace_back(m, b);
+                continue;
+            }
+
+            // Each interval draws its first end, the last one is drawn above
+            plot(a.u, a.v);
+            if (!resolved) continue;
+            for (auto u = std::ceil(a.u); u < b.u; u++) plot(u, a.v + (b.v - a.v) * (u - a.u) / (b.u - a.u));
+        }
+
+        return evaluations;
+    }
+
+    // addFunction
+    /**
+     * @brief Add a function to be plotted by drawFunctions, with its own char and feat. The samples of the function
+     * are cached, so it must always return the same value for the same argument (see invalidateSamples).
+     *
+     * @param function The function.
+     * @param c The char used to draw the function.
+     * @param feat The feat used to draw the function.
+     * @param parallel If true, the function is evaluated on the ThreadPool of the canvas, if any, like in
+     * drawParallel: it must then be safe to call from several threads at once.
+     * @return size_t The id of the function.
+     */
+    size_t Plot2DCanvas::addFunction(const std::function<double(double)> &function, char c, std::string_view feat,
+                                     bool parallel) {
+        functions_.push_back({function, c, std::string(feat), parallel, 0, 0, {}});
+
+        return functions_.size() - 1;
+    }
+
+    // clearFunctions
+    /**
+     * @brief Remove all the functions added with addFunction.
+     *
+     */
+    void Plot2DCanvas::clearFunctions() { functions_.clear(); }
+
+    // invalidateSamples
+    /**
+     * @brief Drop the cached samples of the functions, e.g. because they changed, so that the next drawFunctions
+     * evaluates them again.
+     *
+     */
+    void Plot2DCanvas::invalidateSamples() {
+        for (auto &f: functions_) f.ys.clear();
+    }
+
+    // drawFunctions
+    /**
+     * @brief Plot the functions added with addFunction, one sample per column. The samples of the previous call are
+     * reused for the columns whose x falls on the previous grid of samples: after a pan by whole columns only the
+     * exposed columns are evaluated, and zooming in or out by an integer factor reuses the overlapping samples. The
+     * columns of the functions added as parallel are evaluated on the ThreadPool of the canvas, if any (see
+     * drawParallel); the others are evaluated by the calling thread.
+     *
+     * @return size_t The number of evaluations of the functions.
+     */
+    size_t Plot2DCanvas::drawFunctions() {
+        const int64_t border = isFrameEnabled() ? 1 : 0;
+        const int64_t c0 = border, c1 = static_cast<int64_t>(width_) - 1 - border;
+        const int64_t r0 = border, r1 = static_cast<int64_t>(height_) - 1 - border;
+        if (c1 < c0 || r1 < r0 || scale_x_ == 0 || scale_y_ == 0) return 0;
+
+        const auto columns = static_cast<size_t>(c1 - c0 + 1);
+        const double first = offset_x_ + static_cast<double>(c0) * scale_x_, step = scale_x_;
+        size_t evaluations = 0;
+
+        for (auto &f: functions_) {
+            samples_.resize(columns);
+            pending_.clear();
+            for (size_t u = 0; u < columns; u++) {
+                const double x = first + static_cast<double>(u) * step;
+                const double j = f.ys.empty() ? -1 : (x - f.first) / f.step, cached = std::round(j);
+                const bool hit = cached >= 0 && cached < static_cast<double>(f.ys.size());
+                if (hit && std::abs(j - cached) < sample_tolerance) {
+                    samples_[u] = f.ys[static_cast<size_t>(cached)];
+                } else {
+                    pending_.push_back(u);
+                }
+            }
+
+            evaluate(f.function, first, step, f.parallel);
+            rasterize(f.c, f.feat);
+            evaluations += pending_.size();
+
+            f.ys.swap(samples_);
+            f.first = first;
+            f.step = step;
+        }
+
+        return evaluations;
+    }
+
+    // drawParallel
+    /**
+     * @brief Plot a function, one sample per column, evaluating the columns concurrently on the ThreadPool of the
+     * canvas (serially if there is none). The samples are collected into a buffer which is then drawn by the calling
+     * thread, so the canvas is never written concurrently. It is meant for expensive functions, which must be safe to
+     * call from several threads at once.
+     *
+     * @param function The function to be plotted.
+     * @param c The char used to draw the function.
+     * @param feat The feat used to draw the function.
+     */
+    void Plot2DCanvas::drawParallel(const std::function<double(double)> &function, char c, std::string_view feat) {
+        const int64_t border = isFrameEnabled() ? 1 : 0;
+        const int64_t c0 = border, c1 = static_cast<int64_t>(width_) - 1 - border;
+        if (c1 < c0 || scale_x_ == 0 || scale_y_ == 0) return;
+
+        const auto columns = static_cast<size_t>(c1 - c0 + 1);
+        samples_.resize(columns);
+        pending_.resize(columns);
+        for (size_t u = 0; u < columns; u++) pending_[u] = u;
+
+        evaluate(function, offset_x_ + static_cast<double>(c0) * scale_x_, scale_x_, true);
+        rasterize(c, feat);
+    }
+
+    // pan
+    /**
+     * @brief Move the plotted region by whole columns and rows, i.e. change the offset by multiples of the scale, and
+     * scroll the content of the canvas accordingly. Only the exposed cells need then to be drawn: drawFunctions
+     * evaluates the functions only there.
+     *
+     * @param columns The number of columns to move the region right (left if negative).
+     * @param rows The number of rows to move the region by (in the direction of growing y of the canvas).
+     */
+    void Plot2DCanvas::pan(int32_t columns, int32_t rows) {
+        offset_x_ += static_cast<float>(columns) * scale_x_;
+        offset_y_ += static_cast<float>(rows) * scale_y_;
+        shift(-columns, -rows);
+    }
+
+    // updateLayers
+    /**
+     * @brief Update the axes layer before each refresh.
+     */
+    void Plot2DCanvas::updateLayers() { updateAxes(); }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // extendBounds
+    /**
+     * @brief Extend the bounds of the plot to include a point. Points with non-finite coordinates are ignored.
+     *
+     * @param x The x coordinate of the point.
+     * @param y The y coordinate of the point.
+     */
+    void Plot2DCanvas::extendBounds(float x, float y) {
+        if (!std::isfinite(x) || !std::isfinite(y)) return;
+
+        min_x_ = std::min(min_x_, x);
+        max_x_ = std::max(max_x_, x);
+        min_y_ = std::min(min_y_, y);
+        max_y_ = std::max(max_y_, y);
+    }
+
+    // evaluate
+    /**
+     * @brief Evaluate a function for the columns listed in pending_, storing the values into samples_. In parallel,
+     * the columns are split into a few blocks per thread of the ThreadPool of the canvas, if any, so that blocks of
+     * different cost are balanced among threads.
+     *
+     * @param function The function.
+     * @param first The x of the first column of the drawable area.
+     * @param step The distance in x between two columns.
+     * @param parallel If true, evaluate the function on the ThreadPool. Otherwise by the calling thread.
+     */
+    void Plot2DCanvas::evaluate(const std::function<double(double)> &function, double first, double step,
+                                bool parallel) {
+        if (pending_.empty()) return;
+
+        ThreadPool *pool = parallel ? getThreadPool() : nullptr;
+        const size_t blocks = pool ? std::min(pending_.size(), pool->getThreads() * parallel_blocks_per_thread) : 1;
+
+        const auto &block = [&](size_t b) {
+            const size_t begin = pending_.size() * b / blocks, end = pending_.size() * (b + 1) / blocks;
+            for (size_t i = begin; i < end; i++) {
+                const size_t u = pending_[i];
+                samples_[u] = function(first + static_cast<double>(u) * step);
+            }
+        };
+        if (blocks > 1) {
+            pool->run(blocks, block);
+        } else {
+            block(0);
+        }
+    }
+
+    // rasterize
+    /**
+     * @brief Draw samples_, one sample per column of the drawable area. Samples outside of it are skipped.
+     *
+     * @param c The char used to draw the samples.
+     * @param feat The feat used to draw the samples.
+     */
+    void Plot2DCanvas::rasterize(char c, std::string_view feat) {
+        const int64_t border = isFrameEnabled() ? 1 : 0;
+        const int64_t r0 = border, r1 = static_cast<int64_t>(height_) - 1 - border;
+
+        for (size_t u = 0; u < samples_.size(); u++) {
+            const double v = (samples_[u] - offset_y_) / scale_y_;
+            if (!(v > r0 - 0.5 && v < r1 + 0.5)) continue;  // Also skips NaNs
+            putUnchecked(static_cast<uint32_t>(border + static_cast<int64_t>(u)), static_cast<uint32_t>(std::lround(v)),
+                         c, feat);
+        }
+    }
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+    // nice_number
+    /**
+     * @brief Get a "nice" number, i.e. 1, 2 or 5 (or 10) times a power of 10, approximately equal to x (Heckbert's
+     * algorithm). It is used to choose the distance between the ticks of an axis.
+     *
+     * @param x The positive number to be approximated.
+     * @param round If True the nearest nice number is returned, otherwise the smallest nice number not less than x.
+     * @return double The nice number.
+     */
+    double nice_number(double x, bool round) {
+        double exponent = std::floor(std::log10(x));
+        double fraction = x / std::pow(10, exponent);
+        double nice_fraction;
+
+        if (round) {
+            nice_fraction = fraction < 1.5 ? 1 : fraction < 3 ? 2 : fraction < 7 ? 5 : 10;
+        } else {
+            nice_fraction = fraction <= 1 ? 1 : fraction <= 2 ? 2 : fraction <= 5 ? 5 : 10;
+        }
+
+        return nice_fraction * std::pow(10, exponent);
+    }
+
+    // format_tick
+    /**
+     * @brief Format the label of a tick, with the number of decimals needed to tell it from its neighbors.
+     *
+     * @param value The value of the tick.
+     * @param step The distance between two ticks.
+     * @return std::string The label.
+     */
+    std::string format_tick(double value, double step) {
+        int decimals = step >= 1 ? 0 : static_cast<int>(std::ceil(-std::log10(step) - 1e-9));
+        if (std::abs(value) < step * 1e-6) value = 0;
+
+        // Values too large or steps too small for a fixed-point label use the exponent notation
+        char buffer[32];
+        int size = std::abs(value) >= 1e15 || decimals > 15
+                       ? std::snprintf(buffer, sizeof(buffer), "%g", value)
+                       : std::snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+
+        // snprintf returns the length of the untruncated label, which may not fit into the buffer
+        return std::string(buffer, std::min(static_cast<size_t>(std::max(size, 0)), sizeof(buffer) - 1));
+    }
 }  // namespace osm
\ No newline at end of file
@@ -0,0 +1,444 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file table.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/graphics/table.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/common.hpp>
+#include <osmanip/utility/generic.hpp>
+#include <osmanip/utility/strings.hpp>
+
+// STD headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     Constants
+    //====================================================
+
+    // Size of the output buffered before being written
+    static constexpr size_t block_size = 1 << 16;
+
+    // Mark of the truncated cells, which takes one column
+    static constexpr std::string_view ellipsis = "…";
+
+    //====================================================
+    //     Constructors and destructor
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new Table object.
+     *
+     * @param out The stream which the table is written into.
+     * @param sample_rows The number of rows used to compute the widths of the columns, after which the rows are no
+     * longer buffered. Set to 0 to buffer all the rows until finish.
+     */
+    Table::Table(std::ostream &out, size_t sample_rows)
+        : out_(out),
+          sample_rows_(sample_rows),
+          streaming_(false),
+          rows_(0),
+          columns_(),
+          header_(),
+          header_feat_(""),
+          separator_(" | "),
+          buffer_() {
+        buffer_.reserve(block_size * 2);
+    }
+
+    // Destructor
+    /**
+     * @brief Destroy the Table object, printing the rows not printed yet. Errors of the stream (e.g. if it throws on
+     * failure) are ignored: call finish to handle them.
+     *
+     */
+    Table::~Table() {
+        try {
+            finish();
+        } catch (...) {
+        }
+    }
+
+    //====================================================
+    //     Setters
+    //====================================================
+
+    // setHeader
+    /**
+     * @brief Set the header of the table, printed before the rows and followed by a rule.
+     *
+     * @param header The titles of the columns.
+     * @throws std::runtime_error if the table is already being printed.
+     */
+    void Table::setHeader(const std::vector<std::string> &header) {
+        checkNotStreaming();
+
+        header_ = header;
+        for (size_t i = 0; i < header_.size(); i++) {
+            Column &title = column(i);
+            if (!title.fixed) title.width = std::max(title.width, display_width(header_[i]));
+        }
+    }
+
+    // setWidth
+    /**
+     * @brief Fix the width of a column, instead of computing it from its cells.
+     *
+     * @param column The index of the column.
+     * @param width The width in terminal columns.
+     * @throws std::runtime_error if the width is 0 or the table is already being printed.
+     */
+    void Table::setWidth(size_t column, size_t width) {
+        checkNotStreaming();
+        if (width == 0) throw osm::except_error_func("Table column width", std::to_string(width), "is not valid!");
+
+        Column &fixed = this->column(column);
+        fixed.width = width;
+        fixed.fixed = true;
+    }
+
+    // setAlignment
+    /**
+     * @brief Set the alignment of a column. It can be changed while the table is being printed.
+     *
+     * @param column The index of the column.
+     * @param alignment The alignment: "left" (default), "right" or "center".
+     * @throws std::runtime_error if the alignment is not supported.
+     */
+    void Table::setAlignment(size_t column, std::string_view alignment) {
+        char code;
+        if (alignment == "left") code = 'l';
+        else if (alignment == "right") code = 'r';
+        else if (alignment == "center") code = 'c';
+        else throw osm::except_error_func("Table alignment", std::string(alignment), "is not supported!");
+
+        this->column(column).alignment = code;
+    }
+
+    // setFeat
+    /**
+     * @brief Set the feature (e.g. a color) of the cells of a column. It can be changed while the table is being
+     * printed.
+     *
+     * @param column The index of the column.
+     * @param feat The feature, empty to print the cells as they are.
+     */
+    void Table::setFeat(size_t column, std::string_view feat) { this->column(column).feat = feat; }
+
+    // setHeaderFeat
+    /**
+     * @brief Set the feature (e.g. a style) of the header.
+     *
+     * @param feat The feature, empty to print the header as it is.
+     */
+    void Table::setHeaderFeat(std::string_view feat) { header_feat_ = feat; }
+
+    // setSeparator
+    /**
+     * @brief Set the separator of the columns. If it is ASCII, its '|' chars are drawn as '+' in the rule below the
+     * header.
+     *
+     * @param separator The separator, " | " by default.
+     * @throws std::runtime_error if the table is already being printed.
+     */
+    void Table::setSeparator(std::string_view separator) {
+        checkNotStreaming();
+        separator_ = separator;
+    }
+
+    // setSampleRows
+    /**
+     * @brief Set the number of rows used to compute the widths of the columns.
+     *
+     * @param sample_rows The number of rows, 0 to buffer all the rows until finish.
+     * @throws std::runtime_error if the table is already being printed.
+     */
+    void Table::setSampleRows(size_t sample_rows) {
+        checkNotStreaming();
+        sample_rows_ = sample_rows;
+    }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    // getColumns
+    /**
+     * @brief Get the number of columns.
+     *
+     * @return size_t The number of columns.
+     */
+    size_t Table::getColumns() const { return columns_.size(); }
+
+    // getWidths
+    /**
+     * @brief Get the widths of the columns, which may still grow while the rows are buffered.
+     *
+     * @return std::vector<size_t> The widths in terminal columns.
+     */
+    std::vector<size_t> Table::getWidths() const {
+        std::vector<size_t> widths;
+        widths.reserve(columns_.size());
+        for (const auto &column: columns_) widths.push_back(column.width);
+        return widths;
+    }
+
+    // getRows
+    /**
+     * @brief Get the number of rows added to the table.
+     *
+     * @return uint64_t The number of rows.
+     */
+    uint64_t Table::getRows() const { return rows_; }
+
+    // getSampleRows
+    /**
+     * @brief Get the number of rows used to compute the widths of the columns.
+     *
+     * @return size_t The number of rows, 0 if all the rows are buffered until finish.
+     */
+    size_t Table::getSampleRows() const { return sample_rows_; }
+
+    // isStreaming
+    /**
+     * @brief Return True if the widths are known and the rows are printed as they are added. Otherwise return False.
+     *
+     * @return bool The streaming flag.
+     */
+    bool Table::isStreaming() const { return streaming_; }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // addRow (first overload)
+    /**
+     * @brief Add a row to the table.
+     *
+     * @param cells The cells of the row. Missing cells are printed empty.
+     * @throws std::runtime_error if the row has more cells than the columns of a table which is being printed.
+     */
+    void Table::addRow(std::initializer_list<std::string_view> cells) { addRow(cells.begin(), cells.size()); }
+
+    // addRow (second overload)
+    /**
+     * @brief Add a row to the table.
+     *
+     * @param cells The cells of the row. Missing cells are printed empty.
+     * @throws std::runtime_error if the row has more cells than the columns of a table which is being printed.
+     */
+    void Table::addRow(const std::vector<std::string> &cells) {
+        std::vector<std::string_view> views(cells.begin(), cells.end());
+        addRow(views.data(), views.size());
+    }
+
+    // addRow (third overload)
+    /**
+     * @brief Add a row to the table. Until the widths are known the cells are measured and copied into a single
+     * buffer, then the row is formatted straight into the output buffer.
+     *
+     * @param cells The cells of the row. Missing cells are printed empty.
+     * @param count The number of cells.
+     * @throws std::runtime_error if the row has more cells than the columns of a table which is being printed.
+     */
+    void Table::addRow(const std::string_view *cells, size_t count) {
+        if (!streaming_) {
+            bool fixed = count > 0 || !columns_.empty();
+            for (size_t i = 0; i < std::max(count, columns_.size()); i++) fixed = fixed && column(i).fixed;
+            if (fixed) start();
+        }
+
+        if (streaming_) {
+            if (count > columns_.size()) {
+                throw osm::except_error_func("Table row with", std::to_string(count),
+                                             "cells has more cells than the columns!");
+            }
+            rows_++;
+            appendRow(cells, count, false);
+            flushBuffer(false);
+            return;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            Column &measured = column(i);
+            if (!measured.fixed) measured.width = std::max(measured.width, display_width(cells[i]));
+
+            pending_cells_.append(cells[i]);
+            pending_ends_.push_back(pending_cells_.size());
+        }
+        pending_counts_.push_back(count);
+        rows_++;
+
+        if (sample_rows_ > 0 && pending_counts_.size() >= sample_rows_) start();
+    }
+
+    // finish
+    /**
+     * @brief Print the rows not printed yet and flush the stream. Rows can still be added afterwards, with the same
+     * widths.
+     *
+     */
+    void Table::finish() {
+        if (!streaming_) start();
+
+        flushBuffer(true);
+        out_.flush();
+    }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // column
+    /**
+     * @brief Get a column, adding the missing columns up to it.
+     *
+     * @param index The index of the column.
+     * @return Column& The column.
+     */
+    Table::Column &Table::column(size_t index) {
+        if (index >= columns_.size()) columns_.resize(index + 1, Column{0, false, 'l', ""});
+        return columns_[index];
+    }
+
+    // checkNotStreaming
+    /**
+     * @brief Check that the widths are not known yet, so that the layout can be changed.
+     *
+     * @throws std::runtime_error if the table is already being printed.
+     */
+    void Table::checkNotStreaming() const {
+        if (streaming_) throw std::runtime_error("The layout of a Table cannot change while it is being printed!");
+    }
+
+    // start
+    /**
+     * @brief Print the header and the buffered rows, whose widths are now known, and release their memory.
+     *
+     */
+    void Table::start() {
+        streaming_ = true;
+
+        if (!header_.empty()) {
+            std::vector<std::string_view> titles(header_.begin(), header_.end());
+            appendRow(titles.data(), titles.size(), true);
+            appendRule();
+        }
+
+        size_t begin = 0, cell = 0;
+        std::vector<std::string_view> row;
+        for (const size_t count: pending_counts_) {
+            row.clear();
+            for (size_t i = 0; i < count; i++, cell++) {
+                row.emplace_back(pending_cells_.data() + begin, pending_ends_[cell] - begin);
+                begin = pending_ends_[cell];
+            }
+            appendRow(row.data(), row.size(), false);
+            flushBuffer(false);
+        }
+
+        std::string().swap(pending_cells_);
+        std::vector<size_t>().swap(pending_ends_);
+        std::vector<size_t>().swap(pending_counts_);
+    }
+
+    // appendRow
+    /**
+     * @brief Format a row into the output buffer.
+     *
+     * @param cells The cells of the row.
+     * @param count The number of cells.
+     * @param header True if the row is the header, which uses the header feature instead of the column ones.
+     */
+    void Table::appendRow(const std::string_view *cells, size_t count, bool header) {
+        for (size_t i = 0; i < columns_.size(); i++) {
+            if (i > 0) buffer_.append(separator_);
+
+            const Column &current = columns_[i];
+            appendCell(i < count ? cells[i] : std::string_view(), current, header ? header_feat_ : current.feat,
+                       i + 1 == columns_.size());
+        }
+        buffer_.push_back('\n');
+    }
+
+    // appendCell
+    /**
+     * @brief Format a cell into the output buffer, truncated and padded to the width of its column.
+     *
+     * @param cell The cell.
+     * @param column The column of the cell.
+     * @param prefix The feature printed before the cell.
+     * @param last True if the cell is the last of the row, which is not padded on the right.
+     */
+    void Table::appendCell(std::string_view cell, const Column &column, const std::string &prefix, bool last) {
+        static const std::string &reset_feat = feat(rst, "all");
+
+        size_t width = 0;
+        size_t length = display_prefix(cell, column.width, &width);
+        const bool truncated = length < cell.size() && column.width > 0;
+        if (truncated) length = display_prefix(cell, column.width - 1, &width);
+
+        const size_t padding = column.width - width - (truncated ? 1 : 0);
+        const size_t left = column.alignment == 'r' ? padding : column.alignment == 'c' ? padding / 2 : 0;
+        const bool reset = !prefix.empty() || cell.substr(0, length).find('\033') != std::string_view::npos;
+
+        buffer_.append(left, ' ');
+        buffer_.append(prefix);
+        buffer_.append(cell.data(), length);
+        if (truncated) buffer_.append(ellipsis);
+        if (reset) buffer_.append(reset_feat);
+        if (!last) buffer_.append(padding - left, ' ');
+    }
+
+    // appendRule
+    /**
+     * @brief Format the rule below the header into the output buffer.
+     *
+     */
+    void Table::appendRule() {
+        std::string junction(separator_);
+        for (char &ch: junction) ch = ch == '|' ? '+' : '-';
+        if (junction.size() != display_width(separator_)) junction.assign(display_width(separator_), '-');
+
+        for (size_t i = 0; i < columns_.size(); i++) {
+            if (i > 0) buffer_.append(junction);
+            buffer_.append(columns_[i].width, '-');
+        }
+        buffer_.push_back('\n');
+    }
+
+    // flushBuffer
+    /**
+     * @brief Write the buffered output into the stream.
+     *
+     * @param force If False, the output is written only if at least block_size bytes are buffered.
+     */
+    void Table::flushBuffer(bool force) {
+        if (buffer_.empty() || (!force && buffer_.size() < block_size)) return;
+
+        out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        buffer_.clear();
+    }
+}  // namespace osm
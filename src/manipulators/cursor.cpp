@@ -131,4 +131,151 @@ namespace osm {
 
         return oss.str();
     }
+
+    // csi
+    /**
+     * @brief Return the shortest CSI sequence with a single numeric parameter, omitting the parameter if it is equal
+     * to the default value of 1.
+     *
+     * @param n The numeric parameter.
+     * @param code The final byte of the sequence.
+     * @return std::string The CSI sequence.
+     */
+    static std::string csi(int32_t n, char code) {
+        return n == 1 ? std::string("\u001b[") + code : "\u001b[" + std::to_string(n) + code;
+    }
+
+    // shortest
+    /**
+     * @brief Return the shortest of two encodings, preferring the first one in case of a tie.
+     */
+    static const std::string &shortest(const std::string &a, const std::string &b) {
+        return b.size() < a.size() ? b : a;
+    }
+
+    // move_horizontal
+    /**
+     * @brief Return the shortest sequence which moves the cursor from a column to another one of the same line.
+     */
+    static std::string move_horizontal(int32_t from, int32_t to) {
+        if (from == to) return "";
+
+        std::string best = to == 1 ? "\r" : csi(to, 'G');
+        if (to > from) best = shortest(best, csi(to - from, 'C'));
+        if (to < from) best = shortest(best, move_by(0, to - from));
+        if (to > 1) best = shortest(best, "\r" + csi(to - 1, 'C'));
+
+        return best;
+    }
+
+    // move_by
+    /**
+     * @brief Return the shortest sequence which moves the cursor by a given amount of rows and columns relatively to
+     * its current position. It is meant to be used when the absolute position of the cursor is unknown.
+     *
+     * @param rows The amount of rows to move (positive down, negative up).
+     * @param cols The amount of columns to move (positive right, negative left).
+     * @return std::string The escape sequence.
+     */
+    std::string move_by(int32_t rows, int32_t cols) {
+        std::string out;
+        if (rows != 0) out += csi(rows > 0 ? rows : -rows, rows > 0 ? 'B' : 'A');
+        if (cols > 0) out += csi(cols, 'C');
+        if (cols < 0) {
+            std::string left = csi(-cols, 'D');
+            out += static_cast<size_t>(-cols) < left.size() ? std::string(static_cast<size_t>(-cols), '\b') : left;
+        }
+
+        return out;
+    }
+
+    //====================================================
+    //     CursorPlanner
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new CursorPlanner object, given the current position of the cursor.
+     *
+     * @param row The current row of the cursor.
+     * @param col The current column of the cursor.
+     */
+    CursorPlanner::CursorPlanner(int32_t row, int32_t col) : row_(row), col_(col) {}
+
+    // setPosition
+    /**
+     * @brief Set the position of the cursor, if it has been moved by something else.
+     *
+     * @param row The current row of the cursor.
+     * @param col The current column of the cursor.
+     */
+    void CursorPlanner::setPosition(int32_t row, int32_t col) {
+        row_ = row;
+        col_ = col;
+    }
+
+    // getRow
+    /**
+     * @brief Get the row of the cursor.
+     *
+     * @return int32_t The row of the cursor.
+     */
+    int32_t CursorPlanner::getRow() const { return row_; }
+
+    // getCol
+    /**
+     * @brief Get the column of the cursor.
+     *
+     * @return int32_t The column of the cursor.
+     */
+    int32_t CursorPlanner::getCol() const { return col_; }
+
+    // moveTo
+    /**
+     * @brief Return the shortest sequence which moves the cursor to the given position and update the tracked one.
+     * The absolute address (CUP) is compared with the relative moves and with carriage return plus line feeds.
+     *
+     * @param row The row to reach.
+     * @param col The column to reach.
+     * @return std::string The escape sequence.
+     */
+    std::string CursorPlanner::moveTo(int32_t row, int32_t col) {
+        std::string best;
+        if (row == 1 && col == 1) {
+            best = "\u001b[H";
+        } else if (col == 1) {
+            best = "\u001b[" + std::to_string(row) + "H";
+        } else {
+            best = go_to(row, col);
+        }
+
+        best = shortest(best, move_by(row - row_, 0) + move_horizontal(col_, col));
+        if (row > row_ && static_cast<size_t>(row - row_) < best.size()) {
+            best = shortest(best, "\r" + std::string(static_cast<size_t>(row - row_), '\n') + move_horizontal(1, col));
+        }
+
+        row_ = row;
+        col_ = col;
+
+        return best;
+    }
+
+    // moveBy
+    /**
+     * @brief Return the shortest sequence which moves the cursor by a given amount of rows and columns and update the
+     * tracked position.
+     *
+     * @param rows The amount of rows to move (positive down, negative up).
+     * @param cols The amount of columns to move (positive right, negative left).
+     * @return std::string The escape sequence.
+     */
+    std::string CursorPlanner::moveBy(int32_t rows, int32_t cols) { return moveTo(row_ + rows, col_ + cols); }
+
+    // advance
+    /**
+     * @brief Inform the planner that some characters have been printed on the current line.
+     *
+     * @param cols The number of printed columns.
+     */
+    void CursorPlanner::advance(int32_t cols) { col_ += cols; }
 }  // namespace osm
\ No newline at end of file
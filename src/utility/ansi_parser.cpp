@@ -0,0 +1,173 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file ansi_parser.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_parser.hpp>
+
+// STD headers
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     Constants
+    //====================================================
+
+    // Maximum value of a CSI parameter, larger values are clamped
+    static constexpr int32_t max_param_value = 65535;
+
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    // Default constructor
+    /**
+     * @brief Construct a new AnsiParser object, in the ground state.
+     *
+     */
+    AnsiParser::AnsiParser() : state_(GROUND), params_(), count_(0), prefix_(0) {}
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // parse
+    /**
+     * @brief Parse a chunk of input, reporting its events to a handler. A sequence which is incomplete at the end of
+     * the chunk is completed by the next call.
+     *
+     * @param chunk The chunk of input.
+     * @param handler The handler of the events.
+     */
+    void AnsiParser::parse(std::string_view chunk, AnsiHandler &handler) {
+        const char *p = chunk.data();
+        const char *const end = p + chunk.size();
+
+        while (p < end) {
+
+            // Printable chars (including UTF-8 sequences) are reported in a single run
+            if (state_ == GROUND) {
+                const char *run = p;
+                while (p < end && static_cast<unsigned char>(*p) >= 0x20 && *p != 0x7F) p++;
+                if (p > run) handler.text(std::string_view(run, static_cast<size_t>(p - run)));
+                if (p == end) return;
+            }
+
+            const char ch = *p++;
+            const auto c = static_cast<unsigned char>(ch);
+
+            // ESC, CAN and SUB act in any state
+            if (c == 0x1B) {
+                if (state_ == STRING) state_ = STRING_ESCAPE;
+                else enterEscape();
+                continue;
+            }
+            if (c == 0x18 || c == 0x1A) {
+                state_ = GROUND;
+                continue;
+            }
+
+            // Strings are terminated by BEL or by ESC '\' (ST)
+            if (state_ == STRING) {
+                if (c == 0x07) state_ = GROUND;
+                continue;
+            }
+            if (state_ == STRING_ESCAPE) {
+                state_ = GROUND;
+                if (ch == '\\') continue;
+                enterEscape();
+                p--;
+                continue;
+            }
+
+            // Other control chars are executed even inside a sequence
+            if (c < 0x20) {
+                handler.control(ch);
+                continue;
+            }
+            if (c == 0x7F) continue;
+
+            switch (state_) {
+                case ESCAPE:
+                    if (ch == '[') state_ = CSI_PARAM;
+                    else if (ch == ']' || ch == 'P' || ch == 'X' || ch == '^' || ch == '_') state_ = STRING;
+                    else if (c < 0x30) state_ = ESCAPE_INTERMEDIATE;
+                    else {
+                        state_ = GROUND;
+                        if (c < 0x7F) handler.escape(ch);
+                    }
+                    break;
+                case ESCAPE_INTERMEDIATE:
+                    if (c >= 0x30) state_ = GROUND;
+                    break;
+                case CSI_PARAM:
+                    if ((ch >= '0' && ch <= '9') || ch == ';' || ch == ':') parseParam(ch);
+                    else if (ch >= '<' && ch <= '?' && count_ == 0 && prefix_ == 0) prefix_ = ch;
+                    else if (c >= 0x40 && c < 0x7F) {
+                        state_ = GROUND;
+                        handler.csi(ch, params_, std::min(count_, max_params), prefix_);
+                    } else state_ = CSI_IGNORE;
+                    break;
+                case CSI_IGNORE:
+                    if (c >= 0x40 && c < 0x7F) state_ = GROUND;
+                    break;
+                default: state_ = GROUND;
+            }
+        }
+    }
+
+    // reset
+    /**
+     * @brief Discard the sequence being parsed, if any, going back to the ground state.
+     *
+     */
+    void AnsiParser::reset() { state_ = GROUND; }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // enterEscape
+    /**
+     * @brief Start a new escape sequence, discarding the parameters of the previous one.
+     *
+     */
+    void AnsiParser::enterEscape() {
+        state_ = ESCAPE;
+        count_ = 0;
+        prefix_ = 0;
+    }
+
+    // parseParam
+    /**
+     * @brief Parse a char of the parameters of a CSI sequence. The ':' separator of the sub-parameters (e.g.
+     * "38:5:196") is handled as ';'. The parameters after the first max_params are ignored.
+     *
+     * @param ch A digit or a separator.
+     */
+    void AnsiParser::parseParam(char ch) {
+        if (count_ == 0) params_[count_++] = 0;
+
+        if (ch == ';' || ch == ':') {
+            if (count_ < max_params) params_[count_] = 0;
+            if (count_ <= max_params) count_++;
+        } else if (count_ <= max_params) {
+            int32_t &param = params_[count_ - 1];
+            param = std::min(param * 10 + (ch - '0'), max_param_value);
+        }
+    }
+}  // namespace osm
@@ -0,0 +1,334 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file asciicast_recorder.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/asciicast_recorder.hpp>
+#include <osmanip/utility/terminal.hpp>
+
+// STD headers
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace osm {
+
+    //====================================================
+    //     Constants
+    //====================================================
+
+    // Maximum time the chunks stay in memory before being written
+    static constexpr std::chrono::milliseconds write_interval{200};
+
+    // Size of the buffered chunks which wakes the writer before the interval
+    static constexpr size_t write_threshold = 1 << 18;
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+    // utf8_tail
+    /**
+     * @brief Get the length of the incomplete UTF-8 sequence at the end of a string, if any. Chunks can split a
+     * character, which is then carried to the next event so that each event is valid UTF-8.
+     *
+     * @param str The string.
+     * @return size_t The number of bytes of the incomplete sequence, 0 if the string ends with a whole character.
+     */
+    static size_t utf8_tail(std::string_view str) {
+        for (size_t i = 1; i <= std::min<size_t>(3, str.size()); i++) {
+            auto c = static_cast<unsigned char>(str[str.size() - i]);
+            if ((c & 0xC0) == 0x80) continue;
+            if ((c & 0x80) == 0) return 0;
+
+            size_t length = c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : 2;
+            return length > i ? i : 0;
+        }
+
+        return 0;
+    }
+
+    // append_json_string
+    /**
+     * @brief Append a string to a JSON string literal, escaping the quotes, the backslashes and the control chars
+     * (e.g. the ESC of the ANSI sequences).
+     *
+     * @param out The output string.
+     * @param str The string to be escaped.
+     */
+    static void append_json_string(std::string &out, std::string_view str) {
+        static constexpr char hex[] = "0123456789abcdef";
+
+        for (char ch: str) {
+            auto c = static_cast<unsigned char>(ch);
+            switch (c) {
+                case '"': out.append("\\\""); break;
+                case '\\': out.append("\\\\"); break;
+                case '\n': out.append("\\n"); break;
+                case '\r': out.append("\\r"); break;
+                case '\t': out.append("\\t"); break;
+                default:
+                    if (c < 0x20 || c == 0x7F) {
+                        out.append("\\u00");
+                        out.push_back(hex[c >> 4]);
+                        out.push_back(hex[c & 0xF]);
+                    } else {
+                        out.push_back(ch);
+                    }
+            }
+        }
+    }
+
+    //====================================================
+    //     Constructors and destructor
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new AsciicastRecorder object, creating the file and writing its header.
+     *
+     * @param filename The path of the file, which is replaced if it exists.
+     * @param width The width of the terminal. If 0, the width of the current terminal is used (80 if there is none).
+     * @param height The height of the terminal. If 0, the height of the current terminal is used (24 if there is
+     * none).
+     * @throws std::runtime_error if the file can't be created.
+     */
+    AsciicastRecorder::AsciicastRecorder(std::string_view filename, uint32_t width, uint32_t height)
+        : filename_(filename),
+          width_(width),
+          height_(height),
+          file_(std::fopen(filename_.c_str(), "wb")),
+          start_(clock::now()),
+          events_(0),
+          stop_(false),
+          flush_requests_(0),
+          flushes_(0) {
+        if (!file_) throw std::runtime_error("Cannot create the asciicast file " + filename_ + "!");
+
+        auto [columns, rows] = terminal_size();
+        if (width_ == 0) width_ = columns > 0 ? columns : 80;
+        if (height_ == 0) height_ = rows > 0 ? rows : 24;
+
+        std::fprintf(file_, "{\"version\": 2, \"width\": %u, \"height\": %u, \"timestamp\": %lld}\n", width_, height_,
+                     static_cast<long long>(std::time(nullptr)));
+        std::fflush(file_);
+
+#ifndef OSMANIP_SINGLE_THREADED
+        writer_ = std::thread(&AsciicastRecorder::work, this);
+#endif
+    }
+
+    // Destructor
+    /**
+     * @brief Destroy the AsciicastRecorder object, writing the recorded chunks and closing the file.
+     *
+     */
+    AsciicastRecorder::~AsciicastRecorder() { close(); }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    // getFilename
+    /**
+     * @brief Get the path of the file.
+     *
+     * @return std::string The path of the file.
+     */
+    std::string AsciicastRecorder::getFilename() const { return filename_; }
+
+    // getWidth
+    /**
+     * @brief Get the width of the terminal written into the header.
+     *
+     * @return uint32_t The width of the terminal.
+     */
+    uint32_t AsciicastRecorder::getWidth() const { return width_; }
+
+    // getHeight
+    /**
+     * @brief Get the height of the terminal written into the header.
+     *
+     * @return uint32_t The height of the terminal.
+     */
+    uint32_t AsciicastRecorder::getHeight() const { return height_; }
+
+    // getEvents
+    /**
+     * @brief Get the number of recorded chunks.
+     *
+     * @return uint64_t The number of recorded chunks.
+     */
+    uint64_t AsciicastRecorder::getEvents() {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return events_;
+    }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // record
+    /**
+     * @brief Record a chunk of output as an event, with the time elapsed since the construction. It is ignored after
+     * close.
+     *
+     * @param data The chunk of output.
+     */
+    void AsciicastRecorder::record(std::string_view data) {
+        if (data.empty()) return;
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        if (stop_) return;
+
+        auto time = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start_).count();
+        pending_events_.push_back({time, pending_.size(), data.size()});
+        pending_.append(data);
+        events_++;
+
+        if (pending_.size() < write_threshold) return;
+#ifdef OSMANIP_SINGLE_THREADED
+        pending_.swap(writing_);
+        pending_events_.swap(writing_events_);
+        write();
+#else
+        wake_.notify_one();
+#endif
+    }
+
+    // flush
+    /**
+     * @brief Write all the recorded chunks into the file and wait for the write to complete.
+     *
+     */
+    void AsciicastRecorder::flush() {
+        std::unique_lock<std::mutex> lock{mutex_};
+        if (!file_ || stop_) return;
+
+#ifdef OSMANIP_SINGLE_THREADED
+        pending_.swap(writing_);
+        pending_events_.swap(writing_events_);
+        write();
+#else
+        uint64_t request = ++flush_requests_;
+        wake_.notify_one();
+        done_.wait(lock, [&] { return flushes_ >= request; });
+#endif
+    }
+
+    // close
+    /**
+     * @brief Write all the recorded chunks, stop the writer and close the file. The chunks recorded later are ignored.
+     *
+     */
+    void AsciicastRecorder::close() {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!file_ || stop_) return;
+            stop_ = true;
+        }
+        wake_.notify_one();
+
+#ifdef OSMANIP_SINGLE_THREADED
+        pending_.swap(writing_);
+        pending_events_.swap(writing_events_);
+        write();
+#else
+        writer_.join();
+#endif
+
+        std::lock_guard<std::mutex> lock{mutex_};
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // work
+    /**
+     * @brief Loop of the writer thread: every write_interval (or when many chunks are buffered, or on flush) take the
+     * recorded chunks and write them, until the recorder is closed.
+     *
+     */
+    void AsciicastRecorder::work() {
+        std::unique_lock<std::mutex> lock{mutex_};
+
+        while (true) {
+            wake_.wait_for(lock, write_interval, [this] {
+                return stop_ || flush_requests_ != flushes_ || pending_.size() >= write_threshold;
+            });
+
+            const uint64_t requests = flush_requests_;
+            const bool stop = stop_;
+            pending_.swap(writing_);
+            pending_events_.swap(writing_events_);
+
+            lock.unlock();
+            write();
+            lock.lock();
+
+            flushes_ = requests;
+            done_.notify_all();
+            if (stop) return;
+        }
+    }
+
+    // write
+    /**
+     * @brief Encode the chunks taken from the recorded ones as asciicast output events and append them to the file.
+     *
+     */
+    void AsciicastRecorder::write() {
+        out_.clear();
+
+        for (const auto &event: writing_events_) {
+            std::string_view data(writing_.data() + event.offset, event.size);
+            if (!carry_.empty()) {
+                joined_.assign(carry_).append(data);
+                data = joined_;
+            }
+
+            // An incomplete UTF-8 character is moved to the next event
+            size_t tail = utf8_tail(data);
+            std::string_view text = data.substr(0, data.size() - tail);
+            carry_.assign(data.substr(data.size() - tail));
+            if (text.empty()) continue;
+
+            char time[32];
+            int size = std::snprintf(time, sizeof(time), "%lld.%06lld", static_cast<long long>(event.time / 1000000),
+                                     static_cast<long long>(event.time % 1000000));
+            out_.push_back('[');
+            out_.append(time, static_cast<size_t>(size));
+            out_.append(", \"o\", \"");
+            append_json_string(out_, text);
+            out_.append("\"]\n");
+        }
+
+        writing_.clear();
+        writing_events_.clear();
+        if (out_.empty()) return;
+
+        std::fwrite(out_.data(), 1, out_.size(), file_);
+        std::fflush(file_);
+    }
+}  // namespace osm
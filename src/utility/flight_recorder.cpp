@@ -0,0 +1,371 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file flight_recorder.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Platform headers
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <signal.h>
+
+// My headers
+#include <osmanip/utility/flight_recorder.hpp>
+
+// STD headers
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     Variables
+    //====================================================
+
+    // Recorders dumped on a fatal signal and on exit
+    static std::atomic<FlightRecorder *> crash_recorder{nullptr};
+    static std::atomic<FlightRecorder *> exit_recorder{nullptr};
+
+#ifdef _WIN32
+    static constexpr int fatal_signals[] = {SIGSEGV, SIGABRT, SIGFPE, SIGILL};
+#else
+    static constexpr int fatal_signals[] = {SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL};
+    static struct sigaction old_fatal_actions[std::size(fatal_signals)];
+#endif
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+    // on_fatal_signal
+    /**
+     * @brief Handler of the fatal signals: dump the crash recorder, restore the previous handler and raise the signal
+     * again, so the process terminates (or is handled) as it would without the recorder.
+     *
+     * @param sig The signal number.
+     */
+    static void on_fatal_signal(int sig) {
+        if (FlightRecorder *recorder = crash_recorder.exchange(nullptr)) recorder->dump();
+
+        for (size_t i = 0; i < std::size(fatal_signals); i++) {
+            if (fatal_signals[i] != sig) continue;
+#ifdef _WIN32
+            signal(sig, SIG_DFL);
+#else
+            sigaction(sig, &old_fatal_actions[i], nullptr);
+#endif
+        }
+        raise(sig);
+    }
+
+    // on_process_exit
+    /**
+     * @brief Exit handler: dump the exit recorder.
+     *
+     */
+    static void on_process_exit() {
+        if (FlightRecorder *recorder = exit_recorder.exchange(nullptr)) recorder->dump();
+    }
+
+    // write_all
+    /**
+     * @brief Write a whole buffer into a file descriptor, retrying after partial writes and interruptions. It is
+     * async-signal-safe.
+     *
+     * @param fd The file descriptor.
+     * @param data The buffer.
+     * @param size The size of the buffer.
+     * @return bool True if the buffer has been written.
+     */
+    static bool write_all(int fd, const char *data, size_t size) {
+        while (size > 0) {
+#ifdef _WIN32
+            int written = _write(fd, data, static_cast<unsigned int>(std::min<size_t>(size, 1 << 30)));
+#else
+            ssize_t written = ::write(fd, data, size);
+#endif
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+
+        return true;
+    }
+
+    //====================================================
+    //     Constructors and destructor
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new FlightRecorder object, with an empty ring buffer. The default dump path is
+     * "osmanip_flight_recorder.log".
+     *
+     * @param capacity The size of the ring buffer in bytes, rounded up to a power of 2.
+     */
+    FlightRecorder::FlightRecorder(size_t capacity) : buffer_(), capacity_(1), head_(0), dump_path_() {
+        while (capacity_ < capacity) capacity_ *= 2;
+        buffer_ = std::make_unique<char[]>(capacity_);
+        setDumpPath("osmanip_flight_recorder.log");
+    }
+
+    // Destructor
+    /**
+     * @brief Destroy the FlightRecorder object. If it is dumped on exit, it is dumped now, since it won't be alive at
+     * exit.
+     *
+     */
+    FlightRecorder::~FlightRecorder() {
+        FlightRecorder *self = this;
+        crash_recorder.compare_exchange_strong(self, nullptr);
+
+        self = this;
+        if (exit_recorder.compare_exchange_strong(self, nullptr)) dump();
+    }
+
+    //====================================================
+    //     Setters
+    //====================================================
+
+    // setDumpPath
+    /**
+     * @brief Set the path of the file written by dump.
+     *
+     * @param path The path of the file.
+     * @throws std::runtime_error if the path is longer than 4095 bytes.
+     */
+    void FlightRecorder::setDumpPath(std::string_view path) {
+        if (path.size() >= sizeof(dump_path_)) throw std::runtime_error("FlightRecorder dump path is too long!");
+
+        std::memcpy(dump_path_, path.data(), path.size());
+        dump_path_[path.size()] = '\0';
+    }
+
+    // enableDumpOnCrash
+    /**
+     * @brief Flag to dump the recorder when the process receives a fatal signal (SIGSEGV, SIGABRT, SIGBUS, SIGFPE or
+     * SIGILL). The handlers are installed by the first call and the signal is raised again, after the dump, with the
+     * handler previously installed. Only one recorder at a time is dumped on crash.
+     *
+     * @param dump_on_crash Set to True to enable the dump on crash. Otherwise set to False.
+     */
+    void FlightRecorder::enableDumpOnCrash(bool dump_on_crash) {
+        if (!dump_on_crash) {
+            FlightRecorder *self = this;
+            crash_recorder.compare_exchange_strong(self, nullptr);
+            return;
+        }
+
+        static std::once_flag installed;
+        std::call_once(installed, [] {
+            for (size_t i = 0; i < std::size(fatal_signals); i++) {
+#ifdef _WIN32
+                signal(fatal_signals[i], on_fatal_signal);
+#else
+                struct sigaction action {};
+                action.sa_handler = on_fatal_signal;
+                sigemptyset(&action.sa_mask);
+                action.sa_flags = SA_RESETHAND;
+                sigaction(fatal_signals[i], &action, &old_fatal_actions[i]);
+#endif
+            }
+        });
+        crash_recorder.store(this);
+    }
+
+    // enableDumpOnExit
+    /**
+     * @brief Flag to dump the recorder when the process exits normally (or when the recorder is destroyed, if it
+     * happens before). Only one recorder at a time is dumped on exit.
+     *
+     * @param dump_on_exit Set to True to enable the dump on exit. Otherwise set to False.
+     */
+    void FlightRecorder::enableDumpOnExit(bool dump_on_exit) {
+        if (!dump_on_exit) {
+            FlightRecorder *self = this;
+            exit_recorder.compare_exchange_strong(self, nullptr);
+            return;
+        }
+
+        static std::once_flag installed;
+        std::call_once(installed, [] { std::atexit(on_process_exit); });
+        exit_recorder.store(this);
+    }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    // getCapacity
+    /**
+     * @brief Get the size of the ring buffer.
+     *
+     * @return size_t The size of the ring buffer in bytes.
+     */
+    size_t FlightRecorder::getCapacity() const { return capacity_; }
+
+    // getRecorded
+    /**
+     * @brief Get the number of bytes recorded since the construction (or the last clear), including the ones which
+     * have been overwritten.
+     *
+     * @return uint64_t The number of recorded bytes.
+     */
+    uint64_t FlightRecorder::getRecorded() const { return head_.load(std::memory_order_acquire); }
+
+    // getDumpPath
+    /**
+     * @brief Get the path of the file written by dump.
+     *
+     * @return std::string The path of the file.
+     */
+    std::string FlightRecorder::getDumpPath() const { return dump_path_; }
+
+    // isDumpOnCrashEnabled
+    /**
+     * @brief Return True if the recorder is dumped on crash. Otherwise return False.
+     *
+     * @return bool The dump on crash flag.
+     */
+    bool FlightRecorder::isDumpOnCrashEnabled() const { return crash_recorder.load() == this; }
+
+    // isDumpOnExitEnabled
+    /**
+     * @brief Return True if the recorder is dumped on exit. Otherwise return False.
+     *
+     * @return bool The dump on exit flag.
+     */
+    bool FlightRecorder::isDumpOnExitEnabled() const { return exit_recorder.load() == this; }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // record
+    /**
+     * @brief Append some bytes to the ring buffer, overwriting the oldest ones if it is full. It never locks, so it
+     * can be called concurrently.
+     *
+     * @param data The bytes to be recorded.
+     */
+    void FlightRecorder::record(std::string_view data) {
+        if (data.empty()) return;
+
+        const uint64_t size = data.size();
+        if (data.size() > capacity_) data.remove_prefix(data.size() - capacity_);
+
+        // Only the bytes which fit are copied, but the head moves past all of them
+        const uint64_t head = head_.fetch_add(size, std::memory_order_acq_rel) + size - data.size();
+        const size_t start = static_cast<size_t>(head & (capacity_ - 1));
+        const size_t first = std::min(data.size(), capacity_ - start);
+        std::memcpy(buffer_.get() + start, data.data(), first);
+        std::memcpy(buffer_.get(), data.data() + first, data.size() - first);
+    }
+
+    // str
+    /**
+     * @brief Get the content of the ring buffer, from the oldest to the newest byte.
+     *
+     * @return std::string The content of the ring buffer.
+     */
+    std::string FlightRecorder::str() const {
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        const auto size = static_cast<size_t>(std::min<uint64_t>(head, capacity_));
+        const auto start = static_cast<size_t>((head - size) & (capacity_ - 1));
+        const size_t first = std::min(size, capacity_ - start);
+
+        std::string out;
+        out.reserve(size);
+        out.append(buffer_.get() + start, first);
+        out.append(buffer_.get(), size - first);
+
+        return out;
+    }
+
+    // dump (first overload)
+    /**
+     * @brief Write the content of the ring buffer into the file set with setDumpPath, replacing it. It doesn't
+     * allocate memory or lock, so it can be called from a signal handler.
+     *
+     * @return bool True if the file has been written.
+     */
+    bool FlightRecorder::dump() const { return dumpTo(dump_path_); }
+
+    // dump (second overload)
+    /**
+     * @brief Write the content of the ring buffer into a file, replacing it.
+     *
+     * @param path The path of the file.
+     * @return bool True if the file has been written.
+     */
+    bool FlightRecorder::dump(std::string_view path) const { return dumpTo(std::string(path).c_str()); }
+
+    // clear
+    /**
+     * @brief Empty the ring buffer. It must not run concurrently with record.
+     *
+     */
+    void FlightRecorder::clear() { head_.store(0, std::memory_order_release); }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // dumpTo
+    /**
+     * @brief Write the content of the ring buffer into a file, with plain system calls.
+     *
+     * @param path The path of the file.
+     * @return bool True if the file has been written.
+     */
+    bool FlightRecorder::dumpTo(const char *path) const {
+#ifdef _WIN32
+        int fd = _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+        if (fd < 0) return false;
+
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        const auto size = static_cast<size_t>(std::min<uint64_t>(head, capacity_));
+        const auto start = static_cast<size_t>((head - size) & (capacity_ - 1));
+        const size_t first = std::min(size, capacity_ - start);
+        bool ok = write_all(fd, buffer_.get() + start, first) && write_all(fd, buffer_.get(), size - first);
+
+#ifdef _WIN32
+        ok = _close(fd) == 0 && ok;
+#else
+        ok = ::close(fd) == 0 && ok;
+#endif
+
+        return ok;
+    }
+}  // namespace osm
@@ -0,0 +1,244 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file frame_assembler.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Platform headers
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// My headers
+#include <osmanip/utility/frame_assembler.hpp>
+
+// STD headers
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace osm {
+
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    // Default constructor
+    /**
+     * @brief Construct a new FrameAssembler object, with an empty frame.
+     *
+     */
+    FrameAssembler::FrameAssembler() : size_(0) {}
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    // size
+    /**
+     * @brief Get the size of the frame in bytes.
+     *
+     * @return size_t The size of the frame.
+     */
+    size_t FrameAssembler::size() const { return size_; }
+
+    // getSegments
+    /**
+     * @brief Get the number of segments the frame is made of, i.e. the number of buffers passed to writev.
+     *
+     * @return size_t The number of segments.
+     */
+    size_t FrameAssembler::getSegments() const { return segments_.size(); }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // add
+    /**
+     * @brief Append a fragment to the frame. Fragments shorter than copy_threshold are copied into the internal
+     * buffer, the others are only referenced and must stay alive and unchanged until the frame is written.
+     *
+     * @param fragment The fragment to be appended.
+     * @return FrameAssembler& The assembler itself.
+     */
+    FrameAssembler &FrameAssembler::add(std::string_view fragment) {
+        if (fragment.size() < copy_threshold) return copy(fragment);
+
+        segments_.push_back({fragment.data(), 0, fragment.size()});
+        size_ += fragment.size();
+
+        return *this;
+    }
+
+    // copy
+    /**
+     * @brief Append a copy of a string to the frame. Consecutive copies are merged into a single segment.
+     *
+     * @param str The string to be appended.
+     * @return FrameAssembler& The assembler itself.
+     */
+    FrameAssembler &FrameAssembler::copy(std::string_view str) {
+        if (str.empty()) return *this;
+
+        if (segments_.empty() || segments_.back().data) {
+            segments_.push_back({nullptr, arena_.size(), 0});
+        }
+
+        arena_.append(str);
+        segments_.back().size += str.size();
+        size_ += str.size();
+
+        return *this;
+    }
+
+    // addNumber
+    /**
+     * @brief Append the decimal representation of a number to the frame.
+     *
+     * @param number The number to be appended.
+     * @return FrameAssembler& The assembler itself.
+     */
+    FrameAssembler &FrameAssembler::addNumber(int64_t number) {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+
+        return copy(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)));
+    }
+
+    // append
+    /**
+     * @brief Append all the fragments of another frame, without copying them. The other assembler must stay alive and
+     * unchanged until this frame is written. It is used to join frames assembled in parallel.
+     *
+     * @param other The frame to be appended.
+     * @return FrameAssembler& The assembler itself.
+     */
+    FrameAssembler &FrameAssembler::append(const FrameAssembler &other) {
+        segments_.reserve(segments_.size() + other.segments_.size());
+        for (const auto &segment: other.segments_) {
+            auto v = other.view(segment);
+            segments_.push_back({v.data(), 0, v.size()});
+        }
+        size_ += other.size_;
+
+        return *this;
+    }
+
+    // clear
+    /**
+     * @brief Empty the frame. The memory of the internal buffer is kept to be reused by the next frame.
+     *
+     */
+    void FrameAssembler::clear() {
+        segments_.clear();
+        arena_.clear();
+        size_ = 0;
+    }
+
+    // str
+    /**
+     * @brief Return the whole frame as a single string.
+     *
+     * @return std::string The frame.
+     */
+    std::string FrameAssembler::str() const {
+        std::string out;
+        out.reserve(size_);
+        for (const auto &segment: segments_) out.append(view(segment));
+
+        return out;
+    }
+
+    // write (first overload)
+    /**
+     * @brief Write the frame into an output stream, segment by segment.
+     *
+     * @param os The output stream.
+     */
+    void FrameAssembler::write(std::ostream &os) const {
+        for (const auto &segment: segments_) {
+            auto v = view(segment);
+            os.write(v.data(), static_cast<std::streamsize>(v.size()));
+        }
+    }
+
+    // write (second overload)
+    /**
+     * @brief Write the frame into a file descriptor with a single writev call (more calls are needed only for frames
+     * with more than IOV_MAX segments or for partial writes). Streams writing on the same descriptor, like osm::cout,
+     * must be flushed before.
+     *
+     * @param fd The file descriptor.
+     * @throws std::runtime_error if the write fails.
+     */
+    void FrameAssembler::write(int fd) const {
+#ifdef _WIN32
+        std::string out = str();
+        if (_write(fd, out.data(), static_cast<unsigned int>(out.size())) < 0) {
+            throw std::runtime_error("FrameAssembler write failed!");
+        }
+#else
+        std::vector<iovec> iov;
+        iov.reserve(segments_.size());
+        for (const auto &segment: segments_) {
+            auto v = view(segment);
+            iov.push_back({const_cast<char *>(v.data()), v.size()});
+        }
+
+        size_t first = 0;
+        while (first < iov.size()) {
+            int count = static_cast<int>(std::min<size_t>(iov.size() - first, IOV_MAX));
+            ssize_t written = ::writev(fd, iov.data() + first, count);
+
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("FrameAssembler write failed!");
+            }
+
+            // Skip the buffers which have been written and shift the partially written one
+            auto left = static_cast<size_t>(written);
+            while (first < iov.size() && left >= iov[first].iov_len) left -= iov[first++].iov_len;
+            if (first < iov.size()) {
+                iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + left;
+                iov[first].iov_len -= left;
+            }
+        }
+#endif
+    }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // view
+    /**
+     * @brief Return the bytes of a segment, either referenced or stored into the arena.
+     *
+     * @param segment The segment.
+     * @return std::string_view The bytes of the segment.
+     */
+    std::string_view FrameAssembler::view(const Segment &segment) const {
+        if (segment.data) return std::string_view(segment.data, segment.size);
+
+        return std::string_view(arena_).substr(segment.offset, segment.size);
+    }
+}  // namespace osm
@@ -0,0 +1,286 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file frame_pacer.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/frame_pacer.hpp>
+#include <osmanip/utility/generic.hpp>
+#include <osmanip/utility/locking.hpp>
+
+// STD headers
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace osm {
+
+    //====================================================
+    //     Constants
+    //====================================================
+
+    // Maximum fraction of the time which can be spent writing frames
+    static constexpr double max_duty_cycle = 0.25;
+
+    // Weight of the last sample in the moving averages
+    static constexpr double smoothing = 0.2;
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+    // check_fps
+    /**
+     * @brief Check that a frame rate is positive, since the pacer works with its inverse.
+     *
+     * @param fps The frame rate.
+     * @return double The frame rate.
+     * @throws std::runtime_error if the frame rate is not positive.
+     */
+    static double check_fps(double fps) {
+        if (!(fps > 0)) throw osm::except_error_func("FramePacer frame rate", std::to_string(fps), "is not positive!");
+        return fps;
+    }
+
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new FramePacer object.
+     *
+     * @param max_fps The frame rate used when the output channel is fast.
+     * @param min_fps The lowest frame rate the pacer can back off to.
+     * @throws std::runtime_error if a frame rate is not positive.
+     */
+    FramePacer::FramePacer(double max_fps, double min_fps)
+        : max_fps_(check_fps(max_fps)),
+          min_fps_(check_fps(min_fps)),
+          bytes_per_second_(0),
+          latency_(0),
+          bytes_(0),
+          interval_(1 / max_fps),
+          last_frame_(),
+          first_frame_(true) {}
+
+    //====================================================
+    //     Setters
+    //====================================================
+
+    // setMaxFps
+    /**
+     * @brief Set the frame rate used when the output channel is fast.
+     *
+     * @param max_fps The maximum frame rate.
+     * @throws std::runtime_error if the frame rate is not positive.
+     */
+    void FramePacer::setMaxFps(double max_fps) {
+        std::lock_guard<mutex_type> lock{mutex_};
+        max_fps_ = check_fps(max_fps);
+        adapt();
+    }
+
+    // setMinFps
+    /**
+     * @brief Set the lowest frame rate the pacer can back off to.
+     *
+     * @param min_fps The minimum frame rate.
+     * @throws std::runtime_error if the frame rate is not positive.
+     */
+    void FramePacer::setMinFps(double min_fps) {
+        std::lock_guard<mutex_type> lock{mutex_};
+        min_fps_ = check_fps(min_fps);
+        adapt();
+    }
+
+    // setBytesPerSecond
+    /**
+     * @brief Set the maximum number of bytes per second which can be written. Set to 0 to disable the budget.
+     *
+     * @param bytes_per_second The byte-per-second budget.
+     */
+    void FramePacer::setBytesPerSecond(uint64_t bytes_per_second) {
+        std::lock_guard<mutex_type> lock{mutex_};
+        bytes_per_second_ = bytes_per_second;
+        adapt();
+    }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    // getMaxFps
+    /**
+     * @brief Get the maximum frame rate.
+     *
+     * @return double The maximum frame rate.
+     */
+    double FramePacer::getMaxFps() const { return max_fps_; }
+
+    // getMinFps
+    /**
+     * @brief Get the minimum frame rate.
+     *
+     * @return double The minimum frame rate.
+     */
+    double FramePacer::getMinFps() const { return min_fps_; }
+
+    // getBytesPerSecond
+    /**
+     * @brief Get the byte-per-second budget.
+     *
+     * @return uint64_t The byte-per-second budget, 0 if disabled.
+     */
+    uint64_t FramePacer::getBytesPerSecond() const { return bytes_per_second_; }
+
+    // getFps
+    /**
+     * @brief Get the frame rate currently chosen by the pacer.
+     *
+     * @return double The current frame rate.
+     */
+    double FramePacer::getFps() {
+        std::lock_guard<mutex_type> lock{mutex_};
+        return 1 / interval_.count();
+    }
+
+    // isReducedDetail
+    /**
+     * @brief Return True if the pacer had to back off at least to half of the maximum frame rate. Widgets are then
+     * expected to reduce their detail (e.g. drop the colors) to lower the number of written bytes.
+     *
+     * @return bool The reduced detail flag.
+     */
+    bool FramePacer::isReducedDetail() {
+        std::lock_guard<mutex_type> lock{mutex_};
+        return interval_.count() * max_fps_ > 2;
+    }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // ready
+    /**
+     * @brief Return True if enough time has elapsed since the last frame to draw a new one.
+     *
+     * @return bool The ready flag.
+     */
+    bool FramePacer::ready() {
+        std::lock_guard<mutex_type> lock{mutex_};
+        return first_frame_ || clock::now() - last_frame_ >= interval_;
+    }
+
+    // record
+    /**
+     * @brief Record the size and the write latency of a frame and adapt the frame rate to them.
+     *
+     * @param bytes The number of bytes of the frame.
+     * @param latency The time spent writing the frame.
+     */
+    void FramePacer::record(uint64_t bytes, seconds latency) {
+        std::lock_guard<mutex_type> lock{mutex_};
+
+        if (first_frame_) {
+            latency_ = latency.count();
+            bytes_ = static_cast<double>(bytes);
+            first_frame_ = false;
+        } else {
+            latency_ += smoothing * (latency.count() - latency_);
+            bytes_ += smoothing * (static_cast<double>(bytes) - bytes_);
+        }
+        last_frame_ = clock::now();
+
+        adapt();
+    }
+
+    // write (first overload)
+    /**
+     * @brief Write a frame into an output stream, flush it and record its size and write latency.
+     *
+     * @param os The output stream.
+     * @param frame The frame to be written.
+     */
+    void FramePacer::write(std::ostream &os, std::string_view frame) {
+        auto start = clock::now();
+        os << frame << std::flush;
+        record(frame.size(), clock::now() - start);
+    }
+
+    // write (second overload)
+    /**
+     * @brief Write a frame assembled from fragments into an output stream, flush it and record its size and write
+     * latency.
+     *
+     * @param os The output stream.
+     * @param frame The frame to be written.
+     */
+    void FramePacer::write(std::ostream &os, const FrameAssembler &frame) {
+        auto start = clock::now();
+        frame.write(os);
+        os << std::flush;
+        record(frame.size(), clock::now() - start);
+    }
+
+    // write (third overload)
+    /**
+     * @brief Write a frame assembled from fragments into a file descriptor (see FrameAssembler::write) and record its
+     * size and write latency.
+     *
+     * @param fd The file descriptor.
+     * @param frame The frame to be written.
+     */
+    void FramePacer::write(int fd, const FrameAssembler &frame) {
+        auto start = clock::now();
+        frame.write(fd);
+        record(frame.size(), clock::now() - start);
+    }
+
+    // reset
+    /**
+     * @brief Forget the measured latencies and restore the maximum frame rate.
+     *
+     */
+    void FramePacer::reset() {
+        std::lock_guard<mutex_type> lock{mutex_};
+        latency_ = 0;
+        bytes_ = 0;
+        first_frame_ = true;
+        adapt();
+    }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // adapt
+    /**
+     * @brief Compute the frame interval, so that the writes take at most a fixed fraction of the time and the byte
+     * budget is respected. The caller must own mutex_.
+     *
+     */
+    void FramePacer::adapt() {
+        double interval = std::max(1 / max_fps_, latency_ / max_duty_cycle);
+        if (bytes_per_second_ > 0) {
+            interval = std::max(interval, bytes_ / static_cast<double>(bytes_per_second_));
+        }
+
+        interval_ = seconds(std::min(interval, 1 / min_fps_));
+    }
+}  // namespace osm
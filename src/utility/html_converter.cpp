@@ -0,0 +1,481 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file html_converter.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/graphics/image.hpp>
+#include <osmanip/utility/html_converter.hpp>
+
+// STD headers
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace osm {
+
+    //====================================================
+    //     Constants
+    //====================================================
+
+    // Size of the blocks read by convert and of the output buffered before being written
+    static constexpr size_t block_size = 1 << 16;
+
+    // Color of the default foreground or background
+    static constexpr int32_t default_color = -1;
+
+    // Flag of the 24-bit colors, whose RGB value is in the lower 24 bits
+    static constexpr int32_t truecolor_flag = 1 << 24;
+
+    // Attributes, in the order of their SGR codes and of their classes
+    static constexpr uint32_t bold = 1 << 0, dim = 1 << 1, italic = 1 << 2, underline = 1 << 3, blink = 1 << 4,
+                              inverse = 1 << 5, hidden = 1 << 6, strike = 1 << 7;
+    static constexpr std::string_view attribute_classes[] = {"osm-bold",  "osm-dim",     "osm-italic", "osm-underline",
+                                                             "osm-blink", "osm-inverse", "osm-hidden", "osm-strike"};
+
+    // Attributes set by the SGR codes from 1 to 9
+    static constexpr uint32_t sgr_attributes[] = {0,     bold,    dim,    italic, underline,
+                                                  blink, blink, inverse, hidden, strike};
+
+    // Parts of the HTML document around the stylesheet and the text
+    static constexpr std::string_view document_header =
+        "<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n<style>\n";
+    static constexpr std::string_view document_body = "</style>\n</head>\n<body>\n<pre class=\"osm\">";
+    static constexpr std::string_view document_footer = "</pre>\n</body>\n</html>\n";
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+    // append_hex_color
+    /**
+     * @brief Append a color in the CSS hex notation (e.g. "#ff0000").
+     *
+     * @param out The output string.
+     * @param r The red channel.
+     * @param g The green channel.
+     * @param b The blue channel.
+     */
+    static void append_hex_color(std::string &out, int32_t r, int32_t g, int32_t b) {
+        static constexpr char hex[] = "0123456789abcdef";
+
+        out.push_back('#');
+        for (int32_t channel: {r, g, b}) {
+            out.push_back(hex[(channel >> 4) & 0xF]);
+            out.push_back(hex[channel & 0xF]);
+        }
+    }
+
+    // append_color_class
+    /**
+     * @brief Append the class of a color of the 256-color palette (e.g. "osm-fg-196").
+     *
+     * @param out The output string.
+     * @param background True for the background class, False for the foreground one.
+     * @param index The index of the color.
+     */
+    static void append_color_class(std::string &out, bool background, int32_t index) {
+        char digits[4];
+        auto result = std::to_chars(digits, digits + sizeof(digits), index);
+        out.append(background ? "osm-bg-" : "osm-fg-");
+        out.append(digits, static_cast<size_t>(result.ptr - digits));
+    }
+
+    //====================================================
+    //     Constructors and destructor
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new HtmlConverter object.
+     *
+     * @param out The stream which the HTML is written into.
+     * @param document If True, the output is a whole HTML document, with the stylesheet and a <pre class="osm">
+     * element around the text. Otherwise only the converted text is written, to be embedded into a page which
+     * includes the stylesheet.
+     */
+    HtmlConverter::HtmlConverter(std::ostream &out, bool document)
+        : out_(out),
+          document_(document),
+          finished_(false),
+          pending_cr_(false),
+          span_open_(false),
+          parser_(),
+          style_{default_color, default_color, 0},
+          span_style_(style_),
+          buffer_() {
+        buffer_.reserve(block_size * 2);
+        if (!document_) return;
+
+        buffer_.append(document_header);
+        buffer_.append(stylesheet());
+        buffer_.append(document_body);
+    }
+
+    // Destructor
+    /**
+     * @brief Destroy the HtmlConverter object, finishing the conversion if it has not been finished. Errors of the
+     * stream (e.g. if it throws on failure) are ignored: call finish to handle them.
+     *
+     */
+    HtmlConverter::~HtmlConverter() {
+        try {
+            finish();
+        } catch (...) {
+        }
+    }
+
+    //====================================================
+    //     Operators
+    //====================================================
+
+    // operator ==
+    /**
+     * @brief Compare two styles.
+     *
+     * @param other The other style.
+     * @return bool True if the styles are equal.
+     */
+    bool HtmlConverter::Style::operator==(const Style &other) const {
+        return fg == other.fg && bg == other.bg && attributes == other.attributes;
+    }
+
+    // operator !=
+    /**
+     * @brief Compare two styles.
+     *
+     * @param other The other style.
+     * @return bool True if the styles are different.
+     */
+    bool HtmlConverter::Style::operator!=(const Style &other) const { return !(*this == other); }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // write
+    /**
+     * @brief Convert a chunk of input. Chunks can be split anywhere, even inside an escape sequence or a UTF-8
+     * character.
+     *
+     * @param chunk The chunk of input.
+     * @throws std::runtime_error if the conversion has been finished.
+     */
+    void HtmlConverter::write(std::string_view chunk) {
+        if (finished_) throw std::runtime_error("Cannot write into a finished HtmlConverter!");
+
+        parser_.parse(chunk, *this);
+        flushBuffer(false);
+    }
+
+    // finish
+    /**
+     * @brief Close the open span and the document, if any, and write all the output into the stream. Incomplete
+     * escape sequences at the end of the input are dropped.
+     *
+     */
+    void HtmlConverter::finish() {
+        if (finished_) return;
+        finished_ = true;
+
+        if (pending_cr_) buffer_.push_back('\n');
+        if (span_open_) buffer_.append("</span>");
+        if (document_) buffer_.append(document_footer);
+
+        flushBuffer(true);
+        out_.flush();
+    }
+
+    // convert
+    /**
+     * @brief Convert a whole stream (e.g. a log file), reading it in blocks, so that its size doesn't matter.
+     *
+     * @param in The input stream.
+     * @param out The output stream.
+     * @param document If True, the output is a whole HTML document. Otherwise only the converted text is written.
+     * @return uint64_t The number of bytes read from the input stream.
+     */
+    uint64_t HtmlConverter::convert(std::istream &in, std::ostream &out, bool document) {
+        HtmlConverter converter(out, document);
+        auto block = std::make_unique<char[]>(block_size);
+        uint64_t read = 0;
+
+        while (in) {
+            in.read(block.get(), block_size);
+            const auto size = static_cast<size_t>(in.gcount());
+            if (size == 0) break;
+
+            converter.write(std::string_view(block.get(), size));
+            read += size;
+        }
+        converter.finish();
+
+        return read;
+    }
+
+    // stylesheet
+    /**
+     * @brief Get the CSS rules of the classes used by the converter: the attributes, the 256-color palette (with the
+     * xterm values) for the foreground and the background, and the pre.osm element.
+     *
+     * @return std::string The stylesheet.
+     */
+    std::string HtmlConverter::stylesheet() {
+        const auto fg = palette_rgb(7), bg = palette_rgb(0);
+
+        std::string css;
+        css.reserve(1 << 14);
+        css.append("pre.osm { color: ");
+        append_hex_color(css, fg[0], fg[1], fg[2]);
+        css.append("; background-color: ");
+        append_hex_color(css, bg[0], bg[1], bg[2]);
+        css.append("; }\n");
+
+        css.append(".osm-bold { font-weight: bold; }\n");
+        css.append(".osm-dim { opacity: 0.5; }\n");
+        css.append(".osm-italic { font-style: italic; }\n");
+        css.append(".osm-underline { text-decoration: underline; }\n");
+        css.append(".osm-strike { text-decoration: line-through; }\n");
+        css.append(".osm-underline.osm-strike { text-decoration: underline line-through; }\n");
+        css.append(".osm-blink { animation: osm-blink 1s step-end infinite; }\n");
+        css.append("@keyframes osm-blink { 50% { visibility: hidden; } }\n");
+        css.append(".osm-hidden { visibility: hidden; }\n");
+
+        // Default colors of the inverse text
+        css.append(".osm-fg-inverse { color: ");
+        append_hex_color(css, bg[0], bg[1], bg[2]);
+        css.append("; }\n.osm-bg-inverse { background-color: ");
+        append_hex_color(css, fg[0], fg[1], fg[2]);
+        css.append("; }\n");
+
+        for (bool background: {false, true}) {
+            for (int32_t index = 0; index < 256; index++) {
+                const auto rgb = palette_rgb(static_cast<uint32_t>(index));
+                css.push_back('.');
+                append_color_class(css, background, index);
+                css.append(background ? " { background-color: " : " { color: ");
+                append_hex_color(css, rgb[0], rgb[1], rgb[2]);
+                css.append("; }\n");
+            }
+        }
+
+        return css;
+    }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // text
+    /**
+     * @brief Handle a run of printable text: open the span of the current style, if needed, and append the text
+     * escaping the HTML special chars.
+     *
+     * @param data The run of text.
+     */
+    void HtmlConverter::text(std::string_view data) {
+        if (pending_cr_) {
+            buffer_.push_back('\n');
+            pending_cr_ = false;
+        }
+        updateSpan();
+
+        const char *p = data.data();
+        const char *const end = p + data.size();
+        while (p < end) {
+            const char *run = p;
+            while (p < end && *p != '&' && *p != '<' && *p != '>') p++;
+            buffer_.append(run, static_cast<size_t>(p - run));
+            if (p == end) break;
+
+            switch (*p++) {
+                case '&': buffer_.append("&amp;"); break;
+                case '<': buffer_.append("&lt;"); break;
+                default: buffer_.append("&gt;");
+            }
+        }
+    }
+
+    // control
+    /**
+     * @brief Handle a control char. Line feeds and tabs are kept, while a carriage return not followed by a line feed
+     * (e.g. a progress bar redrawn in place) becomes a line feed, so that each redraw gets its own line. The other
+     * control chars are dropped.
+     *
+     * @param ch The control char.
+     */
+    void HtmlConverter::control(char ch) {
+        if (ch == '\r') {
+            pending_cr_ = true;
+        } else if (ch == '\n') {
+            pending_cr_ = false;
+            buffer_.push_back('\n');
+        } else if (ch == '\t') {
+            text("\t");
+        }
+    }
+
+    // csi
+    /**
+     * @brief Handle a CSI sequence: the SGR ones change the current style, the others are dropped.
+     *
+     * @param code The final byte of the sequence.
+     * @param params The parameters.
+     * @param count The number of parameters.
+     * @param prefix The private prefix.
+     */
+    void HtmlConverter::csi(char code, const int32_t *params, size_t count, char prefix) {
+        if (code == 'm' && prefix == 0) applySgr(params, count);
+    }
+
+    // applySgr
+    /**
+     * @brief Apply the parameters of an SGR sequence to the current style. Unknown parameters are ignored.
+     *
+     * @param params The parameters.
+     * @param count The number of parameters, 0 means a reset.
+     */
+    void HtmlConverter::applySgr(const int32_t *params, size_t count) {
+        if (count == 0) style_ = {default_color, default_color, 0};
+
+        for (size_t i = 0; i < count; i++) {
+            const int32_t param = params[i];
+
+            if (param == 0) style_ = {default_color, default_color, 0};
+            else if (param >= 1 && param <= 9) style_.attributes |= sgr_attributes[param];
+            else if (param == 21) style_.attributes |= underline;
+            else if (param == 22) style_.attributes &= ~(bold | dim);
+            else if (param >= 23 && param <= 29 && param != 26) style_.attributes &= ~sgr_attributes[param - 20];
+            else if (param >= 30 && param <= 37) style_.fg = param - 30;
+            else if (param == 39) style_.fg = default_color;
+            else if (param >= 40 && param <= 47) style_.bg = param - 40;
+            else if (param == 49) style_.bg = default_color;
+            else if (param >= 90 && param <= 97) style_.fg = param - 82;
+            else if (param >= 100 && param <= 107) style_.bg = param - 92;
+            else if (param == 38 || param == 48) {
+
+                // Extended colors: 5;index or 2;r;g;b
+                int32_t &color = param == 38 ? style_.fg : style_.bg;
+                if (i + 2 < count && params[i + 1] == 5) {
+                    if (params[i + 2] < 256) color = params[i + 2];
+                    i += 2;
+                } else if (i + 4 < count && params[i + 1] == 2) {
+                    color = truecolor_flag | (std::min(params[i + 2], 255) << 16) |
+                            (std::min(params[i + 3], 255) << 8) | std::min(params[i + 4], 255);
+                    i += 4;
+                } else {
+                    break;
+                }
+            }
+        }
+    }
+
+    // updateSpan
+    /**
+     * @brief Make the open span match the current style, closing it and opening a new one only if the style has
+     * changed since the last text.
+     *
+     */
+    void HtmlConverter::updateSpan() {
+        if (span_open_ ? span_style_ == style_ : style_ == Style{default_color, default_color, 0}) return;
+
+        if (span_open_) buffer_.append("</span>");
+        span_style_ = style_;
+        span_open_ = span_style_ != Style{default_color, default_color, 0};
+        if (span_open_) openSpan();
+    }
+
+    // openSpan
+    /**
+     * @brief Open the span of the current style. Palette colors become classes, 24-bit colors an inline style, and
+     * the inverse attribute swaps the foreground and the background.
+     *
+     */
+    void HtmlConverter::openSpan() {
+        int32_t fg = span_style_.fg, bg = span_style_.bg;
+        if (span_style_.attributes & inverse) std::swap(fg, bg);
+
+        const bool is_inverse = span_style_.attributes & inverse;
+        const bool fg_rgb = fg & truecolor_flag && fg != default_color;
+        const bool bg_rgb = bg & truecolor_flag && bg != default_color;
+
+        // Classes
+        bool has_class = false;
+        auto begin_class = [&] {
+            buffer_.append(has_class ? " " : " class=\"");
+            has_class = true;
+        };
+
+        buffer_.append("<span");
+        for (size_t bit = 0; bit < std::size(attribute_classes); bit++) {
+            if (!(span_style_.attributes & (1u << bit))) continue;
+            begin_class();
+            buffer_.append(attribute_classes[bit]);
+        }
+        if (fg != default_color && !fg_rgb) {
+            begin_class();
+            append_color_class(buffer_, false, fg);
+        } else if (fg == default_color && is_inverse) {
+            begin_class();
+            buffer_.append("osm-fg-inverse");
+        }
+        if (bg != default_color && !bg_rgb) {
+            begin_class();
+            append_color_class(buffer_, true, bg);
+        } else if (bg == default_color && is_inverse) {
+            begin_class();
+            buffer_.append("osm-bg-inverse");
+        }
+        if (has_class) buffer_.push_back('"');
+
+        // Inline style of the 24-bit colors
+        if (fg_rgb || bg_rgb) {
+            buffer_.append(" style=\"");
+            if (fg_rgb) {
+                buffer_.append("color: ");
+                append_hex_color(buffer_, (fg >> 16) & 0xFF, (fg >> 8) & 0xFF, fg & 0xFF);
+                buffer_.append(bg_rgb ? "; " : ";");
+            }
+            if (bg_rgb) {
+                buffer_.append("background-color: ");
+                append_hex_color(buffer_, (bg >> 16) & 0xFF, (bg >> 8) & 0xFF, bg & 0xFF);
+                buffer_.append(";");
+            }
+            buffer_.push_back('"');
+        }
+
+        buffer_.push_back('>');
+    }
+
+    // flushBuffer
+    /**
+     * @brief Write the buffered output into the stream.
+     *
+     * @param force If False, the output is written only if at least block_size bytes are buffered.
+     */
+    void HtmlConverter::flushBuffer(bool force) {
+        if (buffer_.empty() || (!force && buffer_.size() < block_size)) return;
+
+        out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        buffer_.clear();
+    }
+}  // namespace osm
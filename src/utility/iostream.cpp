@@ -13,13 +13,24 @@
 //     Headers
 //====================================================
 
+// Platform headers
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 // My headers
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/frame_pacer.hpp>
 #include <osmanip/utility/iostream.hpp>
 #include <osmanip/utility/output_redirector.hpp>
 #include <osmanip/utility/sstream.hpp>
 
 // STD headers
+#include <cstdio>
 #include <iostream>
+#include <streambuf>
 
 namespace osm {
 
@@ -31,4 +42,58 @@ namespace osm {
     std::ostream cout(&cout_buf);     /// Link to osm::cout
     OutputRedirector redirout{};
 
-}  // namespace osm
\ No newline at end of file
+    // Buffer of std::cout at startup, to tell whether std::cout has been redirected since
+    static std::streambuf *const stdout_buf = std::cout.rdbuf();
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+    // is_cout_direct
+    /**
+     * @brief Check if osm::cout goes straight to the standard output, i.e. it is not redirected (neither osm::cout
+     * nor std::cout nor by osm::redirout) nor recorded.
+     *
+     * @return bool True if osm::cout goes straight to the standard output. Otherwise False.
+     */
+    bool is_cout_direct() {
+        return cout.rdbuf() == &cout_buf && cout_buf.getOstream() == &std::cout && !cout_buf.getRecorder() &&
+               !redirout.isEnabled() && std::cout.rdbuf() == stdout_buf;
+    }
+
+    // write_frame
+    /**
+     * @brief Write a frame into osm::cout and flush it. If osm::cout goes straight to the standard output (see
+     * is_cout_direct) the streams are flushed and the frame is written into the standard output with a single
+     * scatter-gather write, without copying it into the stream buffers.
+     *
+     * @param frame The frame.
+     * @param pacer The FramePacer which measures the write, if any.
+     */
+    void write_frame(const FrameAssembler &frame, FramePacer *pacer) {
+        if (!is_cout_direct()) {
+            if (pacer) {
+                pacer->write(cout, frame);
+            } else {
+                frame.write(cout);
+                cout << std::flush;
+            }
+            return;
+        }
+
+        cout << std::flush;
+        std::cout << std::flush;
+        std::fflush(stdout);
+#ifdef _WIN32
+        const int fd = _fileno(stdout);
+#else
+        const int fd = STDOUT_FILENO;
+#endif
+        if (pacer) {
+            pacer->write(fd, frame);
+        } else {
+            frame.write(fd);
+        }
+    }
+
+}  // namespace osm
\ No newline at end of file
@@ -16,6 +16,7 @@
 // My headers
 #include <osmanip/utility/generic.hpp>
 #include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/locking.hpp>
 #include <osmanip/utility/output_redirector.hpp>
 #include <osmanip/utility/sstream.hpp>
 #include <osmanip/utility/strings.hpp>
@@ -100,7 +101,7 @@ namespace osm {
      *
      */
     void OutputRedirector::setFilename(std::string_view filename) {
-        std::scoped_lock<std::mutex> slock{this->getMutex()};
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
         filename_ = filename;
         filepath_ = DEFAULT_FILE_DIR + filename_;
 
@@ -121,7 +122,7 @@ namespace osm {
      *
      */
     std::string &OutputRedirector::getFilename() {
-        std::scoped_lock<std::mutex> slock{this->getMutex()};
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
         return filename_;
     }
 
@@ -133,7 +134,7 @@ namespace osm {
      *
      */
     std::string &OutputRedirector::getFilepath() {
-        std::scoped_lock<std::mutex> slock{this->getMutex()};
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
         return filepath_;
     }
 
@@ -174,7 +175,7 @@ namespace osm {
      *
      */
     void OutputRedirector::touch() {
-        std::scoped_lock<std::mutex> slock{this->getMutex()};
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
 
         if (fstream_.open(filename_, std::fstream::in); !fstream_.is_open()) {
             if (fstream_.open(filename_, std::fstream::trunc | std::fstream::out); !fstream_.is_open()) {
@@ -209,7 +210,7 @@ namespace osm {
         // Verify file is available
         touch();
 
-        std::scoped_lock<std::mutex> slock{this->getMutex()};
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
 
         read_file();
         prepare_output();
@@ -303,11 +304,11 @@ namespace osm {
     void OutputRedirector::exception_file_not_found() {
         std::string filename;
         {
-            std::scoped_lock<std::mutex> slock{std::adopt_lock, this->getMutex()};
+            std::scoped_lock<mutex_type> slock{std::adopt_lock, this->getMutex()};
             filename = filename_;
         }
 
         throw std::invalid_argument(std::string("Could not open file ") + "'" + filename + "'");
     }
 
-}  // namespace osm
\ No newline at end of file
+}  // namespace osm
\ No newline at end of file
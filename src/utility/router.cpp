@@ -0,0 +1,201 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file router.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/locking.hpp>
+#include <osmanip/utility/router.hpp>
+
+// STD headers
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace osm {
+
+    //====================================================
+    //     Constructors and destructor
+    //====================================================
+
+    // Default constructor
+    /**
+     * @brief Construct a new Router object, without routes.
+     *
+     */
+    Router::Router() : epoch_(0), dropped_(0) {
+        for (auto &route: routes_) route.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Destructor
+    /**
+     * @brief Destroy the Router object. It must not be in use (e.g. it must be unset from the stream buffers).
+     *
+     */
+    Router::~Router() = default;
+
+    //====================================================
+    //     Setters
+    //====================================================
+
+    // route
+    /**
+     * @brief Set the sink of a tag, replacing the previous one. It returns once no write uses the previous sink any
+     * more, so it can be destroyed.
+     *
+     * @param tag The tag, 0 for the output of the tags without a route.
+     * @param sink The sink, which must outlive the route. Set to nullptr to remove the route.
+     * @throws std::out_of_range if the tag is not lower than max_tags.
+     */
+    void Router::route(uint32_t tag, Recorder *sink) {
+        if (tag >= max_tags) {
+            throw std::out_of_range("Router tag " + std::to_string(tag) + " is out of range!");
+        }
+
+        std::lock_guard<mutex_type> lock{update_mutex_};
+        Recorder *previous = routes_[tag].exchange(sink);
+        if (previous && previous != sink) synchronize();
+    }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    // getRoute
+    /**
+     * @brief Get the sink of a tag.
+     *
+     * @param tag The tag.
+     * @return Recorder* The sink, nullptr if the tag has no route.
+     */
+    Recorder *Router::getRoute(uint32_t tag) const { return tag < max_tags ? routes_[tag].load() : nullptr; }
+
+    // getDropped
+    /**
+     * @brief Get the number of bytes dropped since they had no route (not even the one of tag 0).
+     *
+     * @return uint64_t The number of dropped bytes.
+     */
+    uint64_t Router::getDropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // record (first overload)
+    /**
+     * @brief Route a chunk of output without a tag, i.e. with tag 0.
+     *
+     * @param data The chunk of output.
+     */
+    void Router::record(std::string_view data) { record(0, data); }
+
+    // record (second overload)
+    /**
+     * @brief Route a chunk of output with a tag. It doesn't lock: the sink may be called concurrently by different
+     * threads.
+     *
+     * @param tag The tag.
+     * @param data The chunk of output.
+     */
+    void Router::record(uint32_t tag, std::string_view data) {
+        auto &writers = writers_[epoch_.load() & 1].value;
+        writers.fetch_add(1);
+
+        Recorder *sink = tag < max_tags ? routes_[tag].load() : nullptr;
+        if (!sink) sink = routes_[0].load();
+
+        if (sink) sink->record(data);
+        else dropped_.fetch_add(data.size(), std::memory_order_relaxed);
+
+        writers.fetch_sub(1, std::memory_order_release);
+    }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // synchronize
+    /**
+     * @brief Wait for the writes which may have loaded a replaced sink. Each write is counted on the counter of the
+     * current epoch: the epoch is switched twice, each time waiting for the writes counted on the previous one, so
+     * that new writes don't delay the wait and the writes which read an old epoch are waited too.
+     *
+     */
+    void Router::synchronize() {
+        for (int32_t phase = 0; phase < 2; phase++) {
+            auto &writers = writers_[epoch_.fetch_add(1) & 1].value;
+            while (writers.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+        }
+    }
+
+    //====================================================
+    //     OstreamRecorder
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new OstreamRecorder object.
+     *
+     * @param out The stream which the output is written into, which must outlive the recorder.
+     */
+    OstreamRecorder::OstreamRecorder(std::ostream &out) : out_(out) {}
+
+    // record
+    /**
+     * @brief Write a chunk of output into the stream and flush it.
+     *
+     * @param data The chunk of output.
+     */
+    void OstreamRecorder::record(std::string_view data) {
+        std::lock_guard<mutex_type> lock{mutex_};
+        out_.write(data.data(), static_cast<std::streamsize>(data.size()));
+        out_.flush();
+    }
+
+    //====================================================
+    //     TaggedStream
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new TaggedStream object.
+     *
+     * @param router The Router, which must outlive the stream.
+     * @param tag The tag of the output of the stream.
+     */
+    TaggedStream::TaggedStream(Router &router, uint32_t tag) : std::ostream(nullptr), recorder_(router, tag) {
+        buffer_.setRecorder(&recorder_);
+        rdbuf(&buffer_);
+    }
+
+    // Destructor
+    /**
+     * @brief Destroy the TaggedStream object, flushing the output still buffered.
+     *
+     */
+    TaggedStream::~TaggedStream() { buffer_.pubsync(); }
+
+    // getTag
+    /**
+     * @brief Get the tag of the output of the stream.
+     *
+     * @return uint32_t The tag.
+     */
+    uint32_t TaggedStream::getTag() const { return recorder_.tag; }
+}  // namespace osm
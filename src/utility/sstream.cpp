@@ -15,7 +15,9 @@
 
 // My headers
 #include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/locking.hpp>
 #include <osmanip/utility/output_redirector.hpp>
+#include <osmanip/utility/recorder.hpp>
 #include <osmanip/utility/sstream.hpp>
 
 // STD headers
@@ -23,6 +25,7 @@
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string_view>
 
 namespace osm {
 
@@ -58,7 +61,7 @@ namespace osm {
      * @return the mutex of the object.
      *
      */
-    std::mutex &Stringbuf::getMutex() { return mutex_; }
+    mutex_type &Stringbuf::getMutex() { return mutex_; }
 
     //====================================================
     //     Virtual methods
@@ -82,7 +85,7 @@ namespace osm {
      * @brief Construct a new Ostreambuf object. Default constructor will set the main attributes to default values.
      *
      */
-    Ostreambuf::Ostreambuf() : ostream_(nullptr) {}
+    Ostreambuf::Ostreambuf() : ostream_(nullptr), recorder_(nullptr), echo_(false) {}
 
     // Parametric constructor
     /**
@@ -91,7 +94,7 @@ namespace osm {
      * @param out the std::ostream object to use to output the buffer data.
      *
      */
-    Ostreambuf::Ostreambuf(std::ostream *out) : ostream_(out) {}
+    Ostreambuf::Ostreambuf(std::ostream *out) : ostream_(out), recorder_(nullptr), echo_(false) {}
 
     // Destructor
     /**
@@ -116,7 +119,7 @@ namespace osm {
      *
      */
     void Ostreambuf::setOstream(std::ostream *out) {
-        std::scoped_lock<std::mutex> slock{this->getMutex()};
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
         if (ostream_) {
             ostream_->flush();
         }
@@ -124,6 +127,22 @@ namespace osm {
         ostream_ = out;
     }
 
+    // setRecorder
+    /**
+     * @brief Sets the Recorder object (e.g. a FlightRecorder or an AsciicastRecorder) to route output into. While it
+     * is set the output goes only to the recorder, unless echo is True, in which case it is also sent to the
+     * std::ostream* object. Set to nullptr to go back to the normal output.
+     *
+     * @param recorder the Recorder object, which must outlive the buffer or be unset before being destroyed.
+     * @param echo if True the output is also sent to the std::ostream* object.
+     *
+     */
+    void Ostreambuf::setRecorder(Recorder *recorder, bool echo) {
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
+        recorder_ = recorder;
+        echo_ = echo;
+    }
+
     //====================================================
     //     Getters
     //====================================================
@@ -136,10 +155,22 @@ namespace osm {
      *
      */
     std::ostream *Ostreambuf::getOstream() {
-        std::scoped_lock<std::mutex> slock{this->getMutex()};
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
         return ostream_;
     }
 
+    // getRecorder
+    /**
+     * @brief Returns the current Recorder object.
+     *
+     * @return if present, the Recorder object. Otherwise, nullptr.
+     *
+     */
+    Recorder *Ostreambuf::getRecorder() {
+        std::scoped_lock<mutex_type> slock{this->getMutex()};
+        return recorder_;
+    }
+
     //====================================================
     //     Virtual methods
     //====================================================
@@ -152,7 +183,10 @@ namespace osm {
      *
      */
     int32_t Ostreambuf::sync() {
-        if (redirout.isEnabled()) {
+        if (getRecorder()) {
+            sync_recorder();
+            return ostream_ && echo_ ? ostream_->rdstate() : 0;
+        } else if (redirout.isEnabled()) {
             sync_redirection();
             return redirout.rdstate();
         } else if (ostream_) {
@@ -173,7 +207,9 @@ namespace osm {
      *
      */
     void Ostreambuf::sync_output() {
-        std::scoped_lock<std::mutex> buf_lock(this->getMutex());
+        std::scoped_lock<mutex_type> buf_lock(this->getMutex());
+        if (this->pptr() == this->pbase()) return;  // Inserting an empty buffer would set the failbit of the stream
+
         *ostream_ << this << std::flush;
         this->str("");
     }
@@ -184,8 +220,25 @@ namespace osm {
      *
      */
     void Ostreambuf::sync_redirection() {
-        std::scoped_lock<std::mutex> buf_lock(this->getMutex());
+        std::scoped_lock<mutex_type> buf_lock(this->getMutex());
+        if (this->pptr() == this->pbase()) return;
+
         redirout << this << std::flush;
         this->str("");
     }
-}  // namespace osm
\ No newline at end of file
+
+    // sync_recorder
+    /**
+     * @brief Synchronizes the buffer with the recorder and, if echo is enabled, with the specified std::ostream
+     * object.
+     *
+     */
+    void Ostreambuf::sync_recorder() {
+        std::scoped_lock<mutex_type> buf_lock(this->getMutex());
+        if (!recorder_ || this->pptr() == this->pbase()) return;
+
+        recorder_->record(std::string_view(this->pbase(), static_cast<size_t>(this->pptr() - this->pbase())));
+        if (echo_ && ostream_) *ostream_ << this << std::flush;
+        this->str("");
+    }
+}  // namespace osm
\ No newline at end of file
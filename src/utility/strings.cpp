@@ -14,11 +14,14 @@
 //====================================================
 
 // My headers
+#include <osmanip/utility/ansi_parser.hpp>
 #include <osmanip/utility/iostream.hpp>
 #include <osmanip/utility/strings.hpp>
 
 // STD headers
+#include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <ostream>
@@ -28,6 +31,24 @@
 
 namespace osm {
 
+    //====================================================
+    //     Variables
+    //====================================================
+
+    // Ranges of code points which take no column (combining marks, zero-width spaces and joiners, selectors)
+    static constexpr char32_t zero_width_ranges[][2] = {
+        {0x0300, 0x036F}, {0x0483, 0x0489}, {0x0591, 0x05BD}, {0x0610, 0x061A}, {0x064B, 0x065F},
+        {0x0E31, 0x0E31}, {0x0E34, 0x0E3A}, {0x0E47, 0x0E4E}, {0x1AB0, 0x1AFF}, {0x1DC0, 0x1DFF},
+        {0x200B, 0x200F}, {0x2028, 0x202E}, {0x2060, 0x2064}, {0x20D0, 0x20FF}, {0xFE00, 0xFE0F},
+        {0xFE20, 0xFE2F}, {0xFEFF, 0xFEFF}, {0xE0100, 0xE01EF}};
+
+    // Ranges of code points which take two columns (East Asian wide and fullwidth chars, emoji)
+    static constexpr char32_t wide_ranges[][2] = {
+        {0x1100, 0x115F},   {0x231A, 0x231B},   {0x23E9, 0x23EC},   {0x2614, 0x2615},   {0x2E80, 0x303E},
+        {0x3041, 0x33FF},   {0x3400, 0x4DBF},   {0x4E00, 0x9FFF},   {0xA000, 0xA4CF},   {0xA960, 0xA97F},
+        {0xAC00, 0xD7A3},   {0xF900, 0xFAFF},   {0xFE30, 0xFE4F},   {0xFF00, 0xFF60},   {0xFFE0, 0xFFE6},
+        {0x1F300, 0x1F64F}, {0x1F680, 0x1F6FF}, {0x1F900, 0x1F9FF}, {0x20000, 0x2FFFD}, {0x30000, 0x3FFFD}};
+
     //====================================================
     //     Functions
     //====================================================
@@ -99,55 +120,69 @@ namespace osm {
         std::string res;
         res.reserve(str.size());
 
-        std::string ch;
-        ch.reserve(1);
+        // Applies the events of the parser to the res string, as a terminal would
+        struct Formatter : public AnsiHandler {
+                std::string &dst_str;
+                int32_t &dst_crsr_pos;
 
-        // Get the most recently formatted string (if available)
-        if (last_dst_str_len > 0 && (int32_t)str.size() >= last_dst_str_len) {
-            res = str.substr(0, last_dst_str_len);
-            src_crsr_pos = last_dst_str_len;
-        }
+                Formatter(std::string &str, int32_t &pos) : dst_str(str), dst_crsr_pos(pos) {}
 
-        for (; src_crsr_pos < (int32_t)str.size(); ++src_crsr_pos) {
-            ch = str.at(src_crsr_pos);
+                void put(char ch) {
+                    if (ch == '\n' || dst_crsr_pos >= (int32_t)dst_str.size()) {
+                        dst_str += ch;
+                        dst_crsr_pos = (int32_t)dst_str.size();
+                    } else {
+                        // We don't want to overwrite the new line, so we insert it instead of replacing it
+                        if (dst_str.at(dst_crsr_pos) == '\n') {
+                            dst_str.insert(dst_str.begin() + dst_crsr_pos, ch);
+                        } else {
+                            dst_str.at(dst_crsr_pos) = ch;
+                        }
 
-            if (ch.front() == '\033') {
-                // Extract the ansi escape sequence from str and move past it
-                std::string csi_str = get_ansi_csi_string(str, src_crsr_pos);
+                        ++dst_crsr_pos;
+                    }
+                }
 
-                // Not a complete CSI
-                if (csi_str.empty()) {
-                    if (src_crsr_pos + 1 < (int32_t)str.size() && str.at(src_crsr_pos + 1) == '[') {
-                        // Move past the bracket
-                        src_crsr_pos += 2;
-                    } else {
-                        // Move past the ESC
-                        src_crsr_pos += 1;
+                void text(std::string_view data) override {
+                    for (char ch: data) put(ch);
+                }
+
+                void control(char ch) override {
+                    if (ch != '\r') {
+                        put(ch);
+                        return;
+                    }
+
+                    // Move back to the beginning of the current line
+                    dst_crsr_pos = std::min(dst_crsr_pos, (int32_t)dst_str.size());
+                    while (dst_crsr_pos > 0 && dst_str.at(dst_crsr_pos - 1) != '\n') {
+                        --dst_crsr_pos;
                     }
-                } else {
-                    // Move past the CSI and handle it in the res string
-                    src_crsr_pos += (int32_t)csi_str.size();
-                    handle_csi(csi_str, res, &dst_crsr_pos);
                 }
 
-                --src_crsr_pos;
-            } else {
-                if (ch.front() == '\n' || dst_crsr_pos >= (int32_t)res.size()) {
-                    res += ch;
-                    dst_crsr_pos = (int32_t)res.size();
-                } else {
-                    // We don't want to overwrite the new line, so we insert it instead of replacing it
-                    if (res.at(dst_crsr_pos) == '\n') {
-                        res.insert(dst_crsr_pos, ch);
-                    } else {
-                        res.replace(dst_crsr_pos, 1, ch);
+                void csi(char code, const int32_t *params, size_t count, char prefix) override {
+                    // Only the cursor movements and the erase sequences, with one parameter, change the string
+                    if (prefix != 0 || count > 1 || std::string_view("ABCDJK").find(code) == std::string_view::npos) {
+                        return;
                     }
 
-                    ++dst_crsr_pos;
+                    std::string csi_str = "\033[";
+                    if (count == 1) csi_str += std::to_string(params[0]);
+                    csi_str += code;
+                    handle_csi(csi_str, dst_str, &dst_crsr_pos);
                 }
-            }
+        };
+
+        // Get the most recently formatted string (if available)
+        if (last_dst_str_len > 0 && (int32_t)str.size() >= last_dst_str_len) {
+            res = str.substr(0, last_dst_str_len);
+            src_crsr_pos = last_dst_str_len;
         }
 
+        AnsiParser parser;
+        Formatter formatter(res, dst_crsr_pos);
+        parser.parse(std::string_view(str).substr(src_crsr_pos), formatter);
+
         if (last_pos) {
             *last_pos = dst_crsr_pos;
         }
@@ -191,7 +226,7 @@ namespace osm {
      *
      * @throws std::invalid_argument if the string is not an ANSI CSI.
      *
-     * @return the number of the ANSI CSI if found.
+     * @return the number of the ANSI CSI if found, -1 if it is omitted.
      *
      */
     [[maybe_unused]] int32_t get_ansi_csi_number(const std::string &csi) {
@@ -200,6 +235,11 @@ namespace osm {
         int32_t number = -1;
 
         if (n_pos < csi.size()) {
+            // The number is omitted (e.g. ESC[A), so the default value must be used
+            if (std::isalpha(static_cast<unsigned char>(csi.at(n_pos)))) {
+                return number;
+            }
+
             // Verify the value after the bracket is actually a number
             if (!std::isdigit(csi.at(n_pos))) {
                 char error_msg[32];
@@ -235,6 +275,11 @@ namespace osm {
         const size_t n_pos = 2;
 
         if (n_pos < csi.size()) {
+            // The number is omitted (e.g. ESC[A)
+            if (std::isalpha(static_cast<unsigned char>(csi.at(n_pos)))) {
+                return csi.at(n_pos);
+            }
+
             // Verify the value after the bracket is actually a number
             if (!std::isdigit(csi.at(n_pos))) {
                 char error_msg[32];
@@ -272,6 +317,11 @@ namespace osm {
 
         char code = get_ansi_csi_code(csi_str);
 
+        // Omitted numbers default to 0 for the erase sequences and to 1 for the others
+        if (number < 0) {
+            number = (code == 'J' || code == 'K') ? 0 : 1;
+        }
+
         int32_t curr_pos = *dst_crsr_pos < (int32_t)dst_str.size() ? *dst_crsr_pos : (int32_t)dst_str.size();
         int32_t starting_pos = 0;
         int32_t line_len = 0;
@@ -412,4 +462,139 @@ namespace osm {
         }
     }
 
-}  // namespace osm
\ No newline at end of file
+    // in_ranges
+    /**
+     * @brief Check if a code point is in a sorted list of ranges.
+     *
+     * @param ch the code point.
+     * @param ranges the ranges, with inclusive bounds.
+     *
+     * @return true if the code point is in a range, false otherwise.
+     *
+     */
+    template <size_t N>
+    static bool in_ranges(char32_t ch, const char32_t (&ranges)[N][2]) {
+        if (ch < ranges[0][0] || ch > ranges[N - 1][1]) return false;
+
+        const auto *range = std::upper_bound(ranges, ranges + N, ch,
+                                             [](char32_t value, const char32_t(&r)[2]) { return value < r[0]; });
+        return range != ranges && ch <= (*(range - 1))[1];
+    }
+
+    // next_glyph
+    /**
+     * @brief Measure the unit of text which starts at a position: an escape sequence (CSI, OSC or two chars), a
+     * control char, or a UTF-8 code point. Invalid UTF-8 bytes are measured one by one, as a column each.
+     *
+     * @param str the text.
+     * @param pos the position of the unit.
+     * @param columns the number of terminal columns taken by the unit.
+     *
+     * @return the position after the unit.
+     *
+     */
+    static size_t next_glyph(std::string_view str, size_t pos, size_t &columns) {
+        const auto byte = static_cast<unsigned char>(str[pos]);
+
+        // Escape sequences and control chars
+        if (byte == 0x1B) {
+            columns = 0;
+            if (++pos >= str.size()) return pos;
+            if (str[pos] == '[') {
+                while (++pos < str.size() && (static_cast<unsigned char>(str[pos]) < 0x40 || str[pos] == 0x7F)) {}
+                return std::min(pos + 1, str.size());
+            }
+            if (str[pos] == ']') {
+                while (++pos < str.size() && str[pos] != '\a') {
+                    if (str[pos] == 0x1B && pos + 1 < str.size() && str[pos + 1] == '\\') return pos + 2;
+                }
+                return std::min(pos + 1, str.size());
+            }
+            return pos + 1;
+        }
+        if (byte < 0x20 || byte == 0x7F) {
+            columns = 0;
+            return pos + 1;
+        }
+        if (byte < 0x80) {
+            columns = 1;
+            return pos + 1;
+        }
+
+        // UTF-8 code points
+        const size_t length = byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : byte >= 0xC0 ? 2 : 1;
+        char32_t ch = length == 4 ? byte & 0x07 : length == 3 ? byte & 0x0F : byte & 0x1F;
+        if (length == 1 || byte >= 0xF8 || pos + length > str.size()) {
+            columns = 1;
+            return pos + 1;
+        }
+        for (size_t i = 1; i < length; i++) {
+            const auto next = static_cast<unsigned char>(str[pos + i]);
+            if ((next & 0xC0) != 0x80) {
+                columns = 1;
+                return pos + 1;
+            }
+            ch = (ch << 6) | (next & 0x3F);
+        }
+
+        columns = in_ranges(ch, zero_width_ranges) ? 0 : in_ranges(ch, wide_ranges) ? 2 : 1;
+        return pos + length;
+    }
+
+    // display_width
+    /**
+     * @brief Compute the number of terminal columns taken by a string: escape sequences and control chars take no
+     * column, East Asian wide chars and emoji take two and combining marks none. Runs of printable ASCII chars are
+     * counted without decoding.
+     *
+     * @param str the string.
+     *
+     * @return the width of the string in columns.
+     *
+     */
+    size_t display_width(std::string_view str) {
+        size_t width = 0, columns = 0;
+        for (size_t pos = 0; pos < str.size();) {
+            const auto byte = static_cast<unsigned char>(str[pos]);
+            if (byte >= 0x20 && byte < 0x7F) {
+                width++, pos++;
+                continue;
+            }
+            pos = next_glyph(str, pos, columns);
+            width += columns;
+        }
+        return width;
+    }
+
+    // display_prefix
+    /**
+     * @brief Find the longest prefix of a string which fits into a number of terminal columns. Escape sequences are
+     * never split, and the ones following the prefix without taking columns (e.g. a color reset) are included.
+     *
+     * @param str the string.
+     * @param max_width the number of columns.
+     * @param width [Optional] the width of the prefix in columns.
+     *
+     * @return the length of the prefix in bytes.
+     *
+     */
+    size_t display_prefix(std::string_view str, size_t max_width, size_t *width) {
+        size_t used = 0, columns = 0, pos = 0;
+        while (pos < str.size()) {
+            const auto byte = static_cast<unsigned char>(str[pos]);
+            if (byte >= 0x20 && byte < 0x7F) {
+                if (used == max_width) break;
+                used++, pos++;
+                continue;
+            }
+
+            const size_t next = next_glyph(str, pos, columns);
+            if (used + columns > max_width) break;
+            used += columns;
+            pos = next;
+        }
+        if (width) *width = used;
+        return pos;
+    }
+
+}  // namespace osm
\ No newline at end of file
@@ -0,0 +1,120 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file terminal.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Platform headers
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+// My headers
+#include <osmanip/utility/terminal.hpp>
+
+// STD headers
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace osm {
+
+    //====================================================
+    //     Variables
+    //====================================================
+    static std::atomic<uint64_t> resize_count{0};
+#ifndef _WIN32
+    static struct sigaction old_winch_action;
+#endif
+
+    //====================================================
+    //     Functions
+    //====================================================
+
+#ifndef _WIN32
+    // on_winch
+    /**
+     * @brief SIGWINCH handler: count the resize and forward the signal to the previously installed handler, if any.
+     *
+     * @param sig The signal number.
+     */
+    static void on_winch(int sig) {
+        resize_count.fetch_add(1, std::memory_order_relaxed);
+
+        if (!(old_winch_action.sa_flags & SA_SIGINFO) && old_winch_action.sa_handler != SIG_DFL &&
+            old_winch_action.sa_handler != SIG_IGN) {
+            old_winch_action.sa_handler(sig);
+        }
+    }
+#endif
+
+    // terminal_size
+    /**
+     * @brief Get the size of the terminal attached to the standard output.
+     *
+     * @return std::pair<uint32_t, uint32_t> The number of columns and rows, or {0, 0} if the standard output is not a
+     * terminal.
+     */
+    std::pair<uint32_t, uint32_t> terminal_size() {
+#ifdef _WIN32
+        CONSOLE_SCREEN_BUFFER_INFO info;
+        if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) return {0, 0};
+
+        return {static_cast<uint32_t>(info.srWindow.Right - info.srWindow.Left + 1),
+                static_cast<uint32_t>(info.srWindow.Bottom - info.srWindow.Top + 1)};
+#else
+        winsize ws{};
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) != 0) return {0, 0};
+
+        return {ws.ws_col, ws.ws_row};
+#endif
+    }
+
+    // terminal_resize_count
+    /**
+     * @brief Get the number of times the terminal has been resized. The first call installs a SIGWINCH handler, which
+     * chains the one previously installed, so the count is cheap to poll (e.g. once per frame) and comparing it with
+     * the last seen value tells if the terminal has been resized. On Windows, where there is no such signal, the size
+     * of the console is compared with the one seen by the previous call.
+     *
+     * @return uint64_t The number of resizes.
+     */
+    uint64_t terminal_resize_count() {
+#ifdef _WIN32
+        static std::mutex mutex;
+        static std::pair<uint32_t, uint32_t> last_size = terminal_size();
+
+        std::lock_guard<std::mutex> lock{mutex};
+        auto size = terminal_size();
+        if (size != last_size) {
+            last_size = size;
+            resize_count.fetch_add(1, std::memory_order_relaxed);
+        }
+#else
+        static std::once_flag installed;
+        std::call_once(installed, [] {
+            struct sigaction action {};
+            action.sa_handler = on_winch;
+            sigemptyset(&action.sa_mask);
+            action.sa_flags = SA_RESTART;
+            sigaction(SIGWINCH, &action, &old_winch_action);
+        });
+#endif
+
+        return resize_count.load(std::memory_order_relaxed);
+    }
+}  // namespace osm
@@ -0,0 +1,157 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file thread_pool.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-18
+ * @copyright Copyright (c) 2022 Gianluca Bianco
+ * under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/thread_pool.hpp>
+
+// STD headers
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace osm {
+
+    //====================================================
+    //     Constructors and destructor
+    //====================================================
+
+    // Parametric constructor
+    /**
+     * @brief Construct a new ThreadPool object.
+     *
+     * @param threads The number of threads running the tasks, including the one calling run. If 0, the number of
+     * hardware threads is used.
+     */
+    ThreadPool::ThreadPool([[maybe_unused]] size_t threads)
+        : task_(nullptr), tasks_(0), next_(0), pending_(0), generation_(0), stop_(false) {
+#ifndef OSMANIP_SINGLE_THREADED
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+        workers_.reserve(threads - 1);
+        for (size_t i{1}; i < threads; i++) workers_.emplace_back(&ThreadPool::work, this);
+#endif
+    }
+
+    // Destructor
+    /**
+     * @brief Destroy the ThreadPool object, joining its threads.
+     *
+     */
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stop_ = true;
+        }
+        wake_.notify_all();
+
+        for (auto &worker: workers_) worker.join();
+    }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    // getThreads
+    /**
+     * @brief Get the number of threads running the tasks, including the one calling run.
+     *
+     * @return size_t The number of threads.
+     */
+    size_t ThreadPool::getThreads() const { return workers_.size() + 1; }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // run
+    /**
+     * @brief Run a task for each index in [0, tasks) and wait for all of them to complete. The calling thread takes
+     * part to the job. Tasks must be independent, since they can run in any order. Concurrent calls are serialized.
+     *
+     * @param tasks The number of tasks.
+     * @param task The task, called with the index of the task.
+     * @throws The first exception thrown by a task, once all the tasks completed.
+     */
+    void ThreadPool::run(size_t tasks, const std::function<void(size_t)> &task) {
+        if (tasks == 0) return;
+
+        std::lock_guard<std::mutex> run_lock{run_mutex_};
+        std::unique_lock<std::mutex> lock{mutex_};
+        task_ = &task;
+        tasks_ = tasks;
+        next_ = 0;
+        pending_ = tasks;
+        error_ = nullptr;
+        generation_++;
+        wake_.notify_all();
+
+        runTasks(lock);
+        done_.wait(lock, [this] { return pending_ == 0; });
+        task_ = nullptr;
+
+        if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    // work
+    /**
+     * @brief Loop of the worker threads: wait for a new job and take part to it.
+     *
+     */
+    void ThreadPool::work() {
+        std::unique_lock<std::mutex> lock{mutex_};
+        uint64_t seen = generation_;
+
+        while (true) {
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+
+            seen = generation_;
+            runTasks(lock);
+        }
+    }
+
+    // runTasks
+    /**
+     * @brief Run the tasks of the current job until there are no more left. The lock is released while a task runs.
+     *
+     * @param lock The lock owning mutex_.
+     */
+    void ThreadPool::runTasks(std::unique_lock<std::mutex> &lock) {
+        while (next_ < tasks_) {
+            size_t i = next_++;
+            const auto &task = *task_;
+
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                task(i);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            if (error && !error_) error_ = error;
+            if (--pending_ == 0) done_.notify_all();
+        }
+    }
+}  // namespace osm
@@ -6,7 +6,7 @@ cmake --build build
 
 # Run the script
 ./build/"$1" \
---benchmark_out=data/manipulators.json \
+--benchmark_out=data/"$1".json \
 --benchmark_repetitions=1 \
 --benchmark_display_aggregates_only=false \
 --benchmark_report_aggregates_only=false
\ No newline at end of file
@@ -0,0 +1,83 @@
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/graphics/canvas.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/thread_pool.hpp>
+
+// Extra headers
+#include <benchmark/benchmark.h>
+
+// STD headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//====================================================
+//     Namespace directives
+//====================================================
+namespace bm = benchmark;
+
+//====================================================
+//     Helper functions
+//====================================================
+
+// truecolor_canvas
+static osm::Canvas truecolor_canvas(uint32_t width, uint32_t height) {
+    osm::Canvas canvas(width, height);
+    canvas.enableFrame(true);
+    canvas.setFrame(osm::FrameStyle::BOX);
+
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            canvas.put(x, y, '#', osm::RGB(x % 256, y % 256, (x + y) % 256));
+        }
+    }
+
+    return canvas;
+}
+
+//====================================================
+//     osmanip
+//====================================================
+
+// osmanip_canvas_render_serial
+static void osmanip_canvas_render_serial(bm::State& state) {
+    osm::Canvas canvas = truecolor_canvas(400, 200);
+    osm::FrameAssembler frame;
+
+    for (auto _ : state) {
+        frame.clear();
+        canvas.render(frame);
+        bm::DoNotOptimize(frame.size());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * frame.size()));
+}
+
+// osmanip_canvas_render_parallel
+static void osmanip_canvas_render_parallel(bm::State& state) {
+    osm::Canvas canvas = truecolor_canvas(400, 200);
+    osm::ThreadPool pool(static_cast<size_t>(state.range(0)));
+    osm::FrameAssembler frame;
+    canvas.setThreadPool(&pool);
+
+    for (auto _ : state) {
+        frame.clear();
+        canvas.render(frame);
+        bm::DoNotOptimize(frame.size());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * frame.size()));
+}
+
+//====================================================
+//     Benchmarking settings
+//====================================================
+
+// osmanip
+BENCHMARK(osmanip_canvas_render_serial)->Unit(bm::kMicrosecond);
+BENCHMARK(osmanip_canvas_render_parallel)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(bm::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -9,10 +9,16 @@
 
 // My headers
 #include <osmanip/graphics/canvas.hpp>
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/thread_pool.hpp>
 
 // Extra headers
 #include <doctest/doctest.h>
 
+// STD headers
+#include <stdexcept>
+#include <string>
+
 //====================================================
 //     Testing "Canvas" class
 //====================================================
@@ -54,4 +60,227 @@ TEST_CASE("Testing the Canvas class methods.") {
     }
 
     TEST_SUITE_END();
+
+    //====================================================
+    //     Testing region operations
+    //====================================================
+    TEST_SUITE_BEGIN("Region operations.");
+
+    SUBCASE("Testing fillRect and lines.") {
+        canvas.fillRect(-1, 4, 3, 10, '#', "red");
+        CHECK_EQ(canvas.getChar(0, 4), '#');
+        CHECK_EQ(canvas.getChar(1, 5), '#');
+        CHECK_EQ(canvas.getChar(2, 5), ' ');
+        CHECK_EQ(canvas.getChar(1, 3), ' ');
+        CHECK_EQ(canvas.getFeat(1, 4), "red");
+
+        canvas.drawHLine(3, 0, 10, '-');
+        CHECK_EQ(canvas.getChar(2, 0), ' ');
+        CHECK_EQ(canvas.getChar(4, 0), '-');
+
+        canvas.drawVLine(4, -2, 4, '|');
+        CHECK_EQ(canvas.getChar(4, 0), '|');
+        CHECK_EQ(canvas.getChar(4, 1), '|');
+        CHECK_EQ(canvas.getChar(4, 2), ' ');
+
+        CHECK_NOTHROW(canvas.fillRect(10, 10, 3, 3, 'x'));
+        CHECK_NOTHROW(canvas.fillRect(0, 0, -3, 3, 'x'));
+    }
+
+    SUBCASE("Testing drawText.") {
+        canvas.drawText(-2, 1, "abcdefgh", "feat");
+        CHECK_EQ(canvas.getChar(0, 1), 'c');
+        CHECK_EQ(canvas.getChar(4, 1), 'g');
+        CHECK_EQ(canvas.getFeat(0, 1), "feat");
+        CHECK_EQ(canvas.getChar(0, 2), ' ');
+
+        // A cell per UTF-8 char, with its combining marks
+        canvas.drawText(-1, 3, "día e\u0301✓", "feat");
+        CHECK_EQ(canvas.getGlyph(0, 3), "í");
+        CHECK_EQ(canvas.getChar(0, 3), '?');
+        CHECK_EQ(canvas.getFeat(0, 3), "feat");
+        CHECK_EQ(canvas.getChar(1, 3), 'a');
+        CHECK_EQ(canvas.getGlyph(3, 3), "e\u0301");
+        CHECK_EQ(canvas.getChar(3, 3), 'e');
+        CHECK_EQ(canvas.getGlyph(4, 3), "✓");
+        CHECK_NOTHROW(canvas.drawText(0, 6, "out"));
+    }
+
+    SUBCASE("Testing the table of the feats.") {
+        // Many feats no longer used are dropped, the ones still used are kept
+        canvas.setBackground('.', "bg");
+        canvas.clear();
+        canvas.put(0, 0, 'k', "kept");
+        for (int32_t i = 0; i < 5000; i++) canvas.put(1, 1, 'x', "feat" + std::to_string(i));
+        CHECK_EQ(canvas.getFeat(0, 0), "kept");
+        CHECK_EQ(canvas.getFeat(1, 1), "feat4999");
+        CHECK_EQ(canvas.getFeat(2, 2), "bg");
+        canvas.put(2, 2, 'y', "kept");
+        CHECK_EQ(canvas.getFeat(2, 2), "kept");
+        canvas.put(2, 2, '.', "bg");
+
+        osm::FrameAssembler frame;
+        canvas.render(frame);
+        CHECK_NE(frame.str().find("keptk"), std::string::npos);
+        CHECK_NE(frame.str().find("feat4999x"), std::string::npos);
+    }
+
+    SUBCASE("Testing blit.") {
+        osm::Canvas sprite(2, 2);
+        sprite.fillRect(0, 0, 2, 2, '@', "blue");
+        sprite.put(1, 1, '*');
+
+        canvas.blit(sprite, 4, -1);
+        CHECK_EQ(canvas.getChar(4, 0), '@');
+        CHECK_EQ(canvas.getFeat(4, 0), "blue");
+        CHECK_EQ(canvas.getChar(4, 1), ' ');
+        CHECK_EQ(canvas.getChar(3, 0), ' ');
+
+        canvas.blit(sprite, 1, 2);
+        CHECK_EQ(canvas.getChar(1, 2), '@');
+        CHECK_EQ(canvas.getFeat(1, 2), "blue");
+        CHECK_EQ(canvas.getChar(2, 3), '*');
+
+        canvas.blit(canvas, 1, 0);
+        CHECK_EQ(canvas.getChar(2, 2), '@');
+        CHECK_EQ(canvas.getChar(3, 3), '*');
+    }
+
+    SUBCASE("Testing shift.") {
+        canvas.drawText(0, 0, "abcde", "red");
+        canvas.put(0, 4, 'z');
+
+        canvas.shift(2, 1);
+        CHECK_EQ(canvas.getChar(2, 1), 'a');
+        CHECK_EQ(canvas.getFeat(2, 1), "red");
+        CHECK_EQ(canvas.getChar(4, 1), 'c');
+        CHECK_EQ(canvas.getChar(0, 1), ' ');
+        CHECK_EQ(canvas.getChar(0, 0), ' ');
+        CHECK_EQ(canvas.getChar(2, 5), 'z');
+
+        canvas.shift(-2, -1);
+        CHECK_EQ(canvas.getChar(0, 0), 'a');
+        CHECK_EQ(canvas.getChar(2, 0), 'c');
+        CHECK_EQ(canvas.getChar(3, 0), ' ');
+        CHECK_EQ(canvas.getChar(0, 4), 'z');
+        CHECK_EQ(canvas.getChar(2, 5), ' ');
+
+        canvas.shift(0, 100);
+        CHECK_EQ(canvas.getChar(0, 0), ' ');
+    }
+
+    SUBCASE("Testing resize.") {
+        canvas.drawText(0, 0, "abcde");
+        canvas.put(4, 5, 'z', "feat");
+
+        canvas.setWidth(7);
+        CHECK_EQ(canvas.getChar(3, 0), 'd');
+        CHECK_EQ(canvas.getChar(5, 0), ' ');
+        CHECK_EQ(canvas.getChar(4, 5), 'z');
+        CHECK_EQ(canvas.getFeat(4, 5), "feat");
+
+        canvas.resize(3, 2);
+        CHECK_EQ(canvas.getChar(2, 0), 'c');
+        CHECK_THROWS_AS(canvas.getChar(3, 0), std::out_of_range);
+        CHECK_THROWS_AS(canvas.put(0, 2, 'x'), std::out_of_range);
+
+        canvas.resize(40, 8);
+        CHECK_EQ(canvas.getChar(1, 0), 'b');
+        CHECK_EQ(canvas.getChar(3, 0), ' ');
+        CHECK_EQ(canvas.getChar(4, 5), ' ');
+        CHECK_EQ(canvas.getFeat(4, 5), "");
+        CHECK_EQ(canvas.getChar(39, 7), ' ');
+    }
+
+    SUBCASE("Testing glyphs and images.") {
+        canvas.putGlyph(1, 1, "\u2588", "feat", '#');
+        CHECK_EQ(canvas.getGlyph(1, 1), "\u2588");
+        CHECK_EQ(canvas.getFeat(1, 1), "feat");
+        CHECK_EQ(canvas.getChar(1, 1), '#');
+        CHECK_EQ(canvas.getGlyph(0, 1), " ");
+
+        canvas.put(1, 1, 'a');
+        CHECK_EQ(canvas.getGlyph(1, 1), "a");
+        CHECK_EQ(canvas.getFeat(1, 1), "");
+
+        const uint8_t rgb[] = {255, 0, 0, 0, 0, 255};
+        canvas.drawImage(osm::Image(1, 2, rgb), 4, 5, 1, 1);
+        CHECK_EQ(canvas.getGlyph(4, 5), "\u2580");
+        CHECK_EQ(canvas.getFeat(4, 5), "\033[38;2;255;0;0m\033[48;2;0;0;255m");
+
+        canvas.drawImage(osm::Image(1, 2, rgb), 3, 5, 1, 1, osm::COLOR16);
+        CHECK_EQ(canvas.getFeat(3, 5), "\033[91m\033[44m");
+
+        osm::FrameAssembler frame;
+        canvas.render(frame);
+        CHECK_NE(frame.str().find("\033[91m\033[44m\u2580\033[0m"), std::string::npos);
+    }
+
+    TEST_SUITE_END();
+
+    //====================================================
+    //     Testing layers
+    //====================================================
+    TEST_SUITE_BEGIN("Layers.");
+
+    SUBCASE("Testing static layers.") {
+        osm::Canvas small(3, 1), over(3, 1), under(3, 1);
+        const auto &cells = [&]() {
+            osm::FrameAssembler frame;
+            small.render(frame);
+            std::string out, str = frame.str();
+            for (char c: str) {
+                if (c == 'a' || c == 'b' || c == 'o' || c == 'u' || c == ' ') out += c;
+            }
+            return out;
+        };
+
+        small.put(0, 0, 'a');
+        small.put(1, 0, 'b');
+        over.put(1, 0, 'o');
+        under.fillRect(0, 0, 3, 1, 'u');
+
+        small.addLayer(over, 1);
+        small.addLayer(under, -1);
+        CHECK_EQ(cells(), "aou");
+
+        over.put(0, 0, 'o');
+        CHECK_EQ(cells(), "oou");
+
+        small.removeLayer(over);
+        CHECK_EQ(cells(), "abu");
+
+        small.removeLayer(under);
+        CHECK_EQ(cells(), "ab ");
+
+        CHECK_THROWS_AS(small.addLayer(small, 1), std::runtime_error);
+    }
+
+    TEST_SUITE_END();
+
+    //====================================================
+    //     Testing parallel rendering
+    //====================================================
+    TEST_SUITE_BEGIN("Parallel rendering.");
+
+    SUBCASE("Testing that parallel rendering is identical to the serial one.") {
+        osm::Canvas big(200, 101), layer(200, 101);
+        osm::ThreadPool pool(4);
+        big.enableFrame(true);
+        big.setFrame(osm::FrameStyle::BOX, "\033[31m");
+        for (uint32_t y = 0; y < 101; y++) big.drawText(0, y, std::string(y % 50, 'x'), y % 2 ? "\033[32m" : "");
+        layer.drawVLine(100, 0, 101, '|', "\033[33m");
+        big.addLayer(layer, 1);
+
+        osm::FrameAssembler serial, parallel;
+        big.render(serial);
+        big.setThreadPool(&pool);
+        CHECK_EQ(big.getThreadPool(), &pool);
+        big.render(parallel);
+
+        CHECK_EQ(parallel.size(), serial.size());
+        CHECK_EQ(parallel.str(), serial.str());
+    }
+
+    TEST_SUITE_END();
 }
\ No newline at end of file
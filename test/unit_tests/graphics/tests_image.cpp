@@ -0,0 +1,105 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/graphics/image.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+//====================================================
+//     Testing "Image" class
+//====================================================
+TEST_CASE("Testing the Image class.") {
+    const uint8_t rgb[] = {0, 0, 0, 255, 255, 255, 10, 20, 30, 30, 40, 50};
+    osm::Image image(2, 2, rgb);
+
+    SUBCASE("Testing constructor and getters.") {
+        CHECK_EQ(image.getWidth(), 2);
+        CHECK_EQ(image.getHeight(), 2);
+        CHECK_EQ(image.getPixel(1, 0)[0], 255);
+        CHECK_EQ(image.getPixel(1, 1)[2], 50);
+        CHECK_THROWS_AS(image.getPixel(2, 0), std::out_of_range);
+        CHECK_EQ(osm::Image(3, 1).getPixel(2, 0)[1], 0);
+    }
+
+    SUBCASE("Testing resized.") {
+        osm::Image small = image.resized(1, 1);
+        CHECK_EQ(small.getPixel(0, 0)[0], 74);
+        CHECK_EQ(small.getPixel(0, 0)[1], 79);
+        CHECK_EQ(small.getPixel(0, 0)[2], 84);
+
+        osm::Image row = image.resized(2, 1);
+        CHECK_EQ(row.getPixel(0, 0)[0], 5);
+        CHECK_EQ(row.getPixel(1, 0)[0], 143);
+
+        osm::Image big = image.resized(4, 4);
+        CHECK_EQ(big.getPixel(3, 0)[0], 255);
+        CHECK_EQ(big.getPixel(2, 3)[1], 40);
+    }
+
+    SUBCASE("Testing loadPPM.") {
+        std::istringstream ppm("P6\n# comment\n2 1\n255\n" + std::string("\x01\x02\x03\x04\x05\x06", 6));
+        osm::Image loaded = osm::Image::loadPPM(ppm);
+        CHECK_EQ(loaded.getWidth(), 2);
+        CHECK_EQ(loaded.getHeight(), 1);
+        CHECK_EQ(loaded.getPixel(1, 0)[2], 6);
+
+        std::istringstream ascii("P3\n1 1\n255\n0 0 0\n");
+        CHECK_THROWS_AS(osm::Image::loadPPM(ascii), std::runtime_error);
+
+        std::istringstream truncated("P6\n2 2\n255\n" + std::string("\x01\x02\x03", 3));
+        CHECK_THROWS_AS(osm::Image::loadPPM(truncated), std::runtime_error);
+    }
+}
+
+//====================================================
+//     Testing color functions
+//====================================================
+TEST_CASE("Testing the color functions.") {
+    SUBCASE("Testing nearest_color.") {
+        CHECK_EQ(osm::nearest_color(255, 0, 0, osm::COLOR256), 196);
+        CHECK_EQ(osm::nearest_color(0, 0, 0, osm::COLOR256), 16);
+        CHECK_EQ(osm::nearest_color(138, 138, 138, osm::COLOR256), 245);
+        CHECK_EQ(osm::nearest_color(250, 10, 10, osm::COLOR16), 9);
+        CHECK_EQ(osm::nearest_color(0, 0, 200, osm::COLOR16), 4);
+    }
+
+    SUBCASE("Testing append_color.") {
+        const uint8_t red[] = {255, 0, 0};
+        std::string out;
+
+        osm::append_color(out, red, false, osm::TRUECOLOR);
+        CHECK_EQ(out, "\033[38;2;255;0;0m");
+
+        out.clear();
+        osm::append_color(out, red, true, osm::COLOR256);
+        CHECK_EQ(out, "\033[48;5;196m");
+
+        out.clear();
+        osm::append_color(out, red, false, osm::COLOR16);
+        CHECK_EQ(out, "\033[91m");
+        out.clear();
+        osm::append_color(out, red, true, osm::COLOR16);
+        CHECK_EQ(out, "\033[101m");
+    }
+
+    SUBCASE("Testing dither_bias.") {
+        CHECK_EQ(osm::dither_bias(3, 5, osm::TRUECOLOR), 0);
+        CHECK_LT(osm::dither_bias(0, 0, osm::COLOR16), 0);
+        CHECK_GT(osm::dither_bias(0, 1, osm::COLOR16), 0);
+        CHECK_EQ(osm::dither_bias(1, 2, osm::COLOR256), osm::dither_bias(5, 6, osm::COLOR256));
+    }
+}
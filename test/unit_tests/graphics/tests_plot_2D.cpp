@@ -13,6 +13,13 @@
 // Extra headers
 #include <doctest/doctest.h>
 
+// STD headers
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 //====================================================
 //     Testing "Plot2DCanvas" class
 //====================================================
@@ -39,6 +46,275 @@ TEST_CASE("Testing the Canvas class methods.") {
         cv.setScale(1, 10);
         CHECK_EQ(cv.getScaleX(), 1);
         CHECK_EQ(cv.getScaleY(), 10);
+
+        CHECK_EQ(cv.isAxesEnabled(), false);
+        cv.enableAxes(true);
+        CHECK_EQ(cv.isAxesEnabled(), true);
+        cv.setAxesFeat("feat");
+        CHECK_EQ(cv.getAxesFeat(), "feat");
+    }
+
+    TEST_SUITE_END();
+
+    //====================================================
+    //     Testing axes
+    //====================================================
+    TEST_SUITE_BEGIN("Axes.");
+
+    SUBCASE("Testing nice_number and format_tick.") {
+        CHECK(osm::nice_number(0.7, false) == doctest::Approx(1));
+        CHECK(osm::nice_number(13, false) == doctest::Approx(20));
+        CHECK(osm::nice_number(0.034, true) == doctest::Approx(0.05));
+        CHECK(osm::nice_number(720, true) == doctest::Approx(1000));
+
+        CHECK_EQ(osm::format_tick(200, 100), "200");
+        CHECK_EQ(osm::format_tick(0.15, 0.05), "0.15");
+        CHECK_EQ(osm::format_tick(-1e-17, 0.1), "0.0");
+        CHECK_EQ(osm::format_tick(1e31, 1e30), "1e+31");
+        CHECK_EQ(osm::format_tick(-3e300, 1e299), "-3e+300");
+    }
+
+    SUBCASE("Testing the axes layer.") {
+        osm::Plot2DCanvas plot(21, 11);
+        plot.enableAxes(true);
+        plot.setOffset(-10, -5);
+        plot.updateAxes();
+
+        const osm::Canvas &axes = plot.getAxes();
+        CHECK_EQ(axes.getChar(10, 5), '+');
+        CHECK_EQ(axes.getChar(1, 5), '-');
+        CHECK_EQ(axes.getChar(0, 5), '+');
+        CHECK_EQ(axes.getChar(10, 1), '|');
+        CHECK_EQ(axes.getChar(10, 0), '+');
+        CHECK_EQ(axes.getChar(11, 0), '-');
+        CHECK_EQ(axes.getChar(12, 0), '5');
+        CHECK_EQ(axes.getChar(19, 6), '1');
+        CHECK_EQ(axes.getChar(20, 6), '0');
+
+        // The layout is recomputed only when it changes
+        plot.put(10, 5, 'x');
+        plot.updateAxes();
+        CHECK_EQ(axes.getChar(10, 5), '+');
+        plot.setOffset(-20, -5);
+        plot.updateAxes();
+        CHECK_EQ(axes.getChar(11, 5), '-');
+        CHECK_EQ(axes.getChar(20, 4), '|');
+
+        plot.enableAxes(false);
+        plot.updateAxes();
+        CHECK_EQ(axes.getChar(20, 5), ' ');
+
+        osm::Plot2DCanvas copy(plot);
+        copy.enableAxes(true);
+        copy.updateAxes();
+        CHECK_EQ(copy.getAxes().getChar(20, 5), '+');
+        CHECK_EQ(axes.getChar(20, 5), ' ');
+    }
+
+    TEST_SUITE_END();
+
+    //====================================================
+    //     Testing series
+    //====================================================
+    TEST_SUITE_BEGIN("Series.");
+
+    SUBCASE("Testing multi-series plotting and auto-scaling.") {
+        osm::Plot2DCanvas plot(11, 5);
+        size_t a = plot.addSeries('a');
+        size_t b = plot.addSeries('b', "feat");
+        CHECK_EQ(plot.getSeries(), 2);
+        CHECK(plot.isAutoScaleEnabled());
+
+        plot.addPoint(a, 0, 0);
+        plot.addPoint(a, 10, 4);
+        plot.addPoints(b, {5, std::nanf("")}, {2, 0});
+        CHECK_EQ(plot.getPoints(b), 2);
+        CHECK(plot.getMinX() == doctest::Approx(0));
+        CHECK(plot.getMaxX() == doctest::Approx(10));
+        CHECK(plot.getMinY() == doctest::Approx(0));
+        CHECK(plot.getMaxY() == doctest::Approx(4));
+        CHECK_THROWS_AS(plot.addPoint(2, 0, 0), std::out_of_range);
+        CHECK_THROWS_AS(plot.addPoints(a, {1}, {}), std::runtime_error);
+
+        // y grows upwards
+        plot.drawSeries();
+        CHECK(plot.getScaleX() == doctest::Approx(1));
+        CHECK(plot.getScaleY() == doctest::Approx(-1));
+        CHECK_EQ(plot.getChar(0, 4), 'a');
+        CHECK_EQ(plot.getChar(10, 0), 'a');
+        CHECK_EQ(plot.getChar(5, 2), 'b');
+        CHECK_EQ(plot.getFeat(5, 2), "feat");
+
+        // The bounds follow the new points
+        plot.clear();
+        plot.addPoint(a, 20, 8);
+        plot.drawSeries();
+        CHECK(plot.getScaleX() == doctest::Approx(2));
+        CHECK_EQ(plot.getChar(10, 0), 'a');
+        CHECK_EQ(plot.getChar(5, 2), 'a');
+        CHECK_EQ(plot.getChar(3, 3), 'b');
+
+        plot.clearSeries();
+        CHECK_EQ(plot.getSeries(), 0);
+        CHECK(plot.getMinX() > plot.getMaxX());
+        plot.enableAutoScale(false);
+        CHECK_FALSE(plot.isAutoScaleEnabled());
+    }
+
+    SUBCASE("Testing density scatter plots.") {
+        osm::Plot2DCanvas plot(5, 3);
+        plot.enableAutoScale(false);
+
+        std::vector<float> xs(100, 0), ys(100, 0);
+        xs.insert(xs.end(), {2, 4, 10, std::nanf("")});
+        ys.insert(ys.end(), {1, 2, 0, 0});
+        plot.drawDensity(xs, ys, osm::DensityStyle::PALETTE, "feat");
+        CHECK_EQ(plot.getChar(0, 0), '@');
+        CHECK_EQ(plot.getFeat(0, 0), "feat");
+        CHECK_EQ(plot.getChar(2, 1), '.');
+        CHECK_EQ(plot.getChar(4, 2), '.');
+        CHECK_EQ(plot.getChar(1, 0), ' ');
+        CHECK_THROWS_AS(plot.drawDensity({1}, {}), std::runtime_error);
+
+        // Single points are drawn as '.' even when no cell is denser
+        plot.clear();
+        plot.drawDensity({0, 2}, {0, 1});
+        CHECK_EQ(plot.getChar(0, 0), '.');
+        CHECK_EQ(plot.getChar(2, 1), '.');
+
+        // Two dots in the left column of the first cell and one in the right column of the second
+        plot.clear();
+        plot.setScale(0.5f, 0.25f);
+        plot.setOffset(0.25f, 0.125f);
+        plot.drawDensity({0, 0, 0.8f}, {0, 0.07f, 0.26f}, osm::DensityStyle::BRAILLE);
+        CHECK_EQ(plot.getGlyph(0, 0), "\u2803");
+        CHECK_EQ(plot.getGlyph(1, 1), "\u2808");
+        CHECK_EQ(plot.getChar(0, 0), ':');
+        CHECK_EQ(plot.getChar(2, 2), ' ');
+
+        // Parallel binning gives the same plot
+        osm::ThreadPool pool(3);
+        std::vector<float> many_xs, many_ys;
+        for (int i = 0; i < 100000; i++) {
+            many_xs.push_back(static_cast<float>(i % 7) * 0.7f);
+            many_ys.push_back(static_cast<float>(i % 13) * 0.2f);
+        }
+        osm::Plot2DCanvas serial(9, 5), parallel(9, 5);
+        parallel.setThreadPool(&pool);
+        serial.drawDensity(many_xs, many_ys);
+        parallel.drawDensity(many_xs, many_ys);
+        for (uint32_t y = 0; y < 5; y++) {
+            for (uint32_t x = 0; x < 9; x++) CHECK_EQ(serial.getChar(x, y), parallel.getChar(x, y));
+        }
+        CHECK_NE(serial.getChar(0, 4), ' ');
+    }
+
+    SUBCASE("Testing adaptive sampling.") {
+        osm::Plot2DCanvas plot(41, 7);
+        plot.setOffset(0, -2);
+        CHECK_EQ(plot.getSamplingBudget(), 0);
+
+        // Flat regions are sampled every 4 columns
+        CHECK_EQ(plot.drawAdaptive([](double) { return 0; }, 'x'), 11);
+        for (uint32_t x = 0; x < 41; x++) CHECK_EQ(plot.getChar(x, 2), 'x');
+
+        // Jumps are refined
+        plot.clear();
+        size_t evaluations = plot.drawAdaptive([](double x) { return x < 20.3 ? 0 : 2; }, 'x', "feat");
+        CHECK_EQ(evaluations, 16);
+        CHECK_EQ(plot.getChar(19, 2), 'x');
+        CHECK_EQ(plot.getChar(21, 4), 'x');
+        CHECK_EQ(plot.getChar(20, 4), 'x');
+        CHECK_EQ(plot.getFeat(20, 4), "feat");
+        CHECK_EQ(plot.getChar(19, 3), ' ');
+
+        // The budget is respected, also by the first samples
+        plot.setSamplingBudget(12);
+        CHECK_EQ(plot.getSamplingBudget(), 12);
+        CHECK_EQ(plot.drawAdaptive([](double x) { return x; }, 'x'), 12);
+        plot.setSamplingBudget(5);
+        CHECK_EQ(plot.drawAdaptive([](double x) { return x; }, 'x'), 5);
+
+        osm::Plot2DCanvas wide(200, 7);
+        wide.setSamplingBudget(10);
+        CHECK_LE(wide.drawAdaptive([](double x) { return x; }, 'x'), 10);
+        wide.setSamplingBudget(1);
+        CHECK_EQ(wide.drawAdaptive([](double x) { return x; }, 'x'), 2);
+    }
+
+    SUBCASE("Testing cached samples, pan and zoom.") {
+        osm::Plot2DCanvas plot(10, 5);
+        plot.setOffset(0, 0);
+        size_t calls = 0;
+        plot.addFunction(
+            [&calls](double x) {
+                calls++;
+                return x < 5 ? 1 : 3;
+            },
+            'x', "feat");
+        CHECK_EQ(plot.getFunctions(), 1);
+
+        CHECK_EQ(plot.drawFunctions(), 10);
+        CHECK_EQ(plot.getChar(4, 1), 'x');
+        CHECK_EQ(plot.getChar(5, 3), 'x');
+        CHECK_EQ(plot.drawFunctions(), 0);
+
+        // Only the exposed columns are evaluated
+        plot.pan(3);
+        CHECK(plot.getOffsetX() == doctest::Approx(3));
+        CHECK_EQ(plot.getChar(1, 1), 'x');
+        CHECK_EQ(plot.getChar(2, 3), 'x');
+        CHECK_EQ(plot.getChar(9, 3), ' ');
+        CHECK_EQ(plot.drawFunctions(), 3);
+        CHECK_EQ(plot.getChar(9, 3), 'x');
+        CHECK_EQ(plot.getFeat(9, 3), "feat");
+        CHECK_EQ(calls, 13);
+
+        // Zooming in by 2 reuses every other sample
+        plot.setScale(0.5f, 1);
+        CHECK_EQ(plot.drawFunctions(), 5);
+
+        plot.invalidateSamples();
+        CHECK_EQ(plot.drawFunctions(), 10);
+        plot.clearFunctions();
+        CHECK_EQ(plot.getFunctions(), 0);
+    }
+
+    SUBCASE("Testing parallel sampling.") {
+        osm::ThreadPool pool(4);
+        osm::Plot2DCanvas serial(60, 20), parallel(60, 20);
+        serial.setScale(0.1f, 0.1f);
+        serial.setOffset(0, -1);
+        parallel.setScale(0.1f, 0.1f);
+        parallel.setOffset(0, -1);
+        parallel.setThreadPool(&pool);
+
+        std::atomic<size_t> calls{0};
+        const auto &function = [&calls](double x) {
+            calls++;
+            return std::sin(x);
+        };
+        serial.drawParallel(function, 'x', "feat");
+        parallel.drawParallel(function, 'x', "feat");
+        CHECK_EQ(calls.load(), 120);
+        for (uint32_t y = 0; y < 20; y++) {
+            for (uint32_t x = 0; x < 60; x++) CHECK_EQ(serial.getChar(x, y), parallel.getChar(x, y));
+        }
+        CHECK_EQ(parallel.getChar(0, 10), 'x');
+
+        // Cached functions are evaluated in parallel only if added as such
+        const auto caller = std::this_thread::get_id();
+        std::atomic<size_t> other_threads{0};
+        parallel.addFunction(
+            [&](double x) {
+                if (std::this_thread::get_id() != caller) other_threads++;
+                return std::cos(x);
+            },
+            '+');
+        parallel.addFunction(function, 'o', "", true);
+        CHECK_EQ(parallel.drawFunctions(), 120);
+        CHECK_EQ(other_threads.load(), 0);
+        CHECK_EQ(parallel.getChar(0, 10), 'o');
     }
 
     TEST_SUITE_END();
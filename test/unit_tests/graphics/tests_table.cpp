@@ -0,0 +1,99 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/graphics/table.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/common.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//====================================================
+//     Testing Table class
+//====================================================
+TEST_CASE("Testing the Table class.") {
+    std::ostringstream out;
+
+    SUBCASE("Testing widths computed from all the rows.") {
+        osm::Table table(out);
+        table.setHeader({"name", "size"});
+        table.setAlignment(1, "right");
+        table.addRow({"a", "1"});
+        table.addRow({"longer", "12345"});
+        CHECK(!table.isStreaming());
+        CHECK_EQ(out.str(), "");
+
+        table.finish();
+        CHECK(table.isStreaming());
+        CHECK_EQ(table.getRows(), 2);
+        CHECK(table.getWidths() == std::vector<size_t>{6, 5});
+        CHECK_EQ(out.str(),
+                 "name   |  size\n"
+                 "-------+------\n"
+                 "a      |     1\n"
+                 "longer | 12345\n");
+    }
+
+    SUBCASE("Testing sample rows and truncation.") {
+        osm::Table table(out, 2);
+        table.setSeparator(" ");
+        table.setAlignment(0, "center");
+        table.addRow({"abc", "x"});
+        table.addRow({"a"});
+        CHECK(table.isStreaming());
+        CHECK_EQ(table.getColumns(), 2);
+
+        // The widths are known: later rows are printed at once and truncated to them
+        table.addRow({"abcdef", "xyz"});
+        table.finish();
+        CHECK_EQ(out.str(),
+                 "abc x\n"
+                 " a  \n"
+                 "ab… …\n");
+        CHECK_THROWS_AS(table.addRow({"a", "b", "c"}), std::runtime_error);
+        CHECK_THROWS_AS(table.setHeader({"late"}), std::runtime_error);
+    }
+
+    SUBCASE("Testing fixed widths, features and display widths.") {
+        osm::Table table(out);
+        table.setWidth(0, 4);
+        table.setWidth(1, 3);
+        table.setFeat(1, osm::feat(osm::col, "red"));
+        CHECK_THROWS_AS(table.setWidth(0, 0), std::runtime_error);
+        CHECK_THROWS_AS(table.setAlignment(0, "justify"), std::runtime_error);
+
+        // All the widths are fixed: nothing is buffered
+        table.addRow({"日本", "\033[1mb\033[0m"});
+        CHECK(table.isStreaming());
+        table.addRow({"日本語", "c"});
+        table.finish();
+        CHECK_EQ(out.str(), "日本 | " + osm::feat(osm::col, "red") + "\033[1mb\033[0m" +
+                                osm::feat(osm::rst, "all") + "\n日…  | " + osm::feat(osm::col, "red") +
+                                "c" + osm::feat(osm::rst, "all") + "\n");
+    }
+
+    SUBCASE("Testing many rows.") {
+        {
+            osm::Table table(out, 10);
+            table.setHeaderFeat(osm::feat(osm::sty, "bold"));
+            table.setHeader({"index"});
+            for (int32_t i = 0; i < 100000; i++) table.addRow({std::to_string(i)});
+        }
+        const std::string text = out.str();
+        CHECK_EQ(text.substr(0, 14), osm::feat(osm::sty, "bold") + "index" + osm::feat(osm::rst, "all") + "\n");
+        CHECK_EQ(text.substr(text.size() - 6), "99999\n");
+    }
+}
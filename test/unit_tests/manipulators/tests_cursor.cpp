@@ -46,4 +46,47 @@ TEST_CASE("Testing the go_to function.") {
     static const std::string test_string_goto = "\u001b[" + std::to_string(2) + ";"s + std::to_string(5) + "H"s;
 
     CHECK_EQ(osm::go_to(2, 5), test_string_goto);
-}
\ No newline at end of file
+}
+
+//====================================================
+//     Testing "move_by" function
+//====================================================
+TEST_CASE("Testing the move_by function.") {
+    CHECK_EQ(osm::move_by(0, 0), "");
+    CHECK_EQ(osm::move_by(-1, 0), "\u001b[A");
+    CHECK_EQ(osm::move_by(3, 0), "\u001b[3B");
+    CHECK_EQ(osm::move_by(0, 12), "\u001b[12C");
+    CHECK_EQ(osm::move_by(0, -2), "\b\b");
+    CHECK_EQ(osm::move_by(0, -20), "\u001b[20D");
+}
+
+//====================================================
+//     Testing "CursorPlanner" class
+//====================================================
+TEST_CASE("Testing the CursorPlanner class.") {
+    osm::CursorPlanner planner(10, 40);
+
+    SUBCASE("Testing getters and setters.") {
+        CHECK_EQ(planner.getRow(), 10);
+        CHECK_EQ(planner.getCol(), 40);
+
+        planner.setPosition(3, 4);
+        CHECK_EQ(planner.getRow(), 3);
+        CHECK_EQ(planner.getCol(), 4);
+
+        planner.advance(5);
+        CHECK_EQ(planner.getCol(), 9);
+    }
+
+    SUBCASE("Testing the chosen encodings.") {
+        CHECK_EQ(planner.moveTo(10, 40), "");
+        CHECK_EQ(planner.moveTo(10, 1), "\r");
+        CHECK_EQ(planner.moveTo(11, 1), "\r\n");
+        CHECK_EQ(planner.moveTo(10, 1), "\u001b[A");
+        CHECK_EQ(planner.moveTo(1, 1), "\u001b[H");
+        CHECK_EQ(planner.moveTo(120, 80), osm::go_to(120, 80));
+        CHECK_EQ(planner.moveBy(0, -1), "\b");
+        CHECK_EQ(planner.getRow(), 120);
+        CHECK_EQ(planner.getCol(), 79);
+    }
+}
@@ -0,0 +1,93 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/progressbar/async_progress.hpp>
+#include <osmanip/progressbar/progress_bar.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// The tests are compiled only as C++20, like AsyncProgress
+#ifdef OSMANIP_PROGRESSBAR_ASYNCPROGRESS_AVAILABLE
+
+// STD headers
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <vector>
+
+//====================================================
+//     Helpers
+//====================================================
+
+// Coroutine which runs eagerly until its end
+struct Task {
+        struct promise_type {
+                Task get_return_object() { return {}; }
+                std::suspend_never initial_suspend() noexcept { return {}; }
+                std::suspend_never final_suspend() noexcept { return {}; }
+                void return_void() {}
+                void unhandled_exception() { std::terminate(); }
+        };
+};
+
+// Coroutine which reports its steps
+static Task run_steps(osm::AsyncProgress<int32_t> &progress, int32_t steps, std::vector<uint64_t> &resumed) {
+    for (int32_t i = 0; i < steps; i++) resumed.push_back(co_await progress.step());
+}
+
+//====================================================
+//     Testing AsyncProgress
+//====================================================
+TEST_CASE("Testing the AsyncProgress class.") {
+    SUBCASE("Testing steps from a coroutine.") {
+        osm::ProgressBar<int32_t> bar(0, 100);
+        bar.setStyle("loader", "#");
+
+        std::vector<uint64_t> resumed;
+        {
+            osm::AsyncProgress<int32_t> progress(bar, 1000, std::chrono::milliseconds(1));
+            CHECK_EQ(progress.getTotal(), 1000);
+            run_steps(progress, 1000, resumed);
+            CHECK_EQ(progress.getCompleted(), 1000);
+        }
+        osm::cout << std::endl;
+
+        REQUIRE(resumed.size() == 1000);
+        CHECK_EQ(resumed.front(), 1);
+        CHECK_EQ(resumed.back(), 1000);
+        CHECK_EQ(bar.getIteratingVar(), 100);
+    }
+
+    SUBCASE("Testing steps from several threads.") {
+        osm::ProgressBar<int32_t> bar(0, 10);
+        bar.setStyle("loader", "#");
+        osm::AsyncProgress<int32_t> progress(bar, 4000);
+
+        std::vector<std::thread> threads;
+        for (int32_t t = 0; t < 4; t++) {
+            threads.emplace_back([&progress] {
+                std::vector<uint64_t> resumed;
+                run_steps(progress, 1000, resumed);
+            });
+        }
+        for (auto &thread: threads) thread.join();
+
+        progress.finish();
+        progress.finish();
+        osm::cout << std::endl;
+        CHECK_EQ(progress.getCompleted(), 4000);
+        CHECK_EQ(bar.getIteratingVar(), 100);
+    }
+}
+
+#endif
@@ -0,0 +1,107 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/progressbar/completion_tracker.hpp>
+#include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/utility/frame_pacer.hpp>
+#include <osmanip/utility/thread_pool.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+//====================================================
+//     Testing CompletionTracker
+//====================================================
+TEST_CASE("Testing the CompletionTracker class.") {
+    SUBCASE("Testing completions from a thread pool.") {
+        osm::CompletionTracker tracker(64);
+        CHECK_EQ(tracker.getTotal(), 64);
+        CHECK_EQ(tracker.getCompleted(), 0);
+
+        osm::ThreadPool pool(4);
+        std::thread runner([&] { pool.run(64, [&](size_t) { tracker.complete(); }); });
+
+        std::vector<size_t> reports;
+        tracker.wait([&](size_t completed) { reports.push_back(completed); });
+        runner.join();
+
+        REQUIRE(!reports.empty());
+        CHECK_LE(reports.size(), 64);
+        CHECK_EQ(reports.back(), 64);
+        for (size_t i = 1; i < reports.size(); i++) CHECK_GT(reports[i], reports[i - 1]);
+        CHECK_EQ(tracker.getCompleted(), 64);
+    }
+
+    SUBCASE("Testing a ProgressBar.") {
+        osm::ProgressBar<int32_t> bar(0, 10);
+        bar.setStyle("loader", "#");
+
+        osm::CompletionTracker tracker(5);
+        std::thread worker([&] {
+            for (int32_t i = 0; i < 5; i++) tracker.complete();
+        });
+        tracker.wait(bar);
+        worker.join();
+        osm::cout << std::endl;
+        CHECK_EQ(bar.getIteratingVar(), 100);
+    }
+
+    SUBCASE("Testing floating-point ProgressBars.") {
+        // The last update reaches 100% and is printed even if the FramePacer is not ready
+        for (float max: {1.f, 100.f}) {
+            osm::FramePacer slow(1, 1);
+            osm::ProgressBar<float> bar(0, max);
+            bar.setStyle("indicator", "%");
+            bar.setFramePacer(&slow);
+
+            std::stringstream ss;
+            auto old_buffer{osm::cout.rdbuf(ss.rdbuf())};
+            osm::CompletionTracker::update(bar, 2, 4);
+            osm::CompletionTracker::update(bar, 4, 4);
+            osm::cout << std::flush;
+            osm::cout.rdbuf(old_buffer);
+            CHECK_NE(ss.str().find("100"), std::string::npos);
+        }
+    }
+
+    SUBCASE("Testing futures completing out of order.") {
+        std::vector<std::future<int32_t>> futures;
+        for (int32_t i = 0; i < 8; i++) {
+            futures.push_back(std::async(std::launch::async, [i] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5 * (8 - i)));
+                return i;
+            }));
+        }
+
+        std::vector<size_t> reports;
+        osm::CompletionTracker::waitFutures(
+            futures, [&](size_t completed) { reports.push_back(completed); }, std::chrono::milliseconds(1));
+        REQUIRE(!reports.empty());
+        CHECK_EQ(reports.back(), 8);
+        for (int32_t i = 0; i < 8; i++) CHECK_EQ(futures[i].get(), i);
+
+        // ProgressBar overload, with shared futures
+        std::vector<std::shared_future<void>> shared;
+        for (int32_t i = 0; i < 4; i++) shared.push_back(std::async(std::launch::async, [] {}).share());
+        osm::ProgressBar<int32_t> bar(0, 4);
+        bar.setStyle("loader", "#");
+        osm::CompletionTracker::waitFutures(shared, bar);
+        osm::cout << std::endl;
+        CHECK_EQ(bar.getIteratingVar(), 100);
+    }
+}
@@ -89,5 +89,38 @@ TEST_CASE("Testing MultiProgressBar class") {
         }
     }
 
+    //====================================================
+    //     Testing "log" method
+    //====================================================
+    SUBCASE("Testing the log and flush_logs methods") {
+        bar1.setMin(0);
+        bar1.setMax(60);
+        bar1.setStyle("indicator", "%");
+
+        std::stringstream ss;
+        auto old_buffer{osm::cout.rdbuf(ss.rdbuf())};
+
+        bars.for_one(0, osm::updater{}, 10);
+        ss.str("");
+
+        // Log lines are only queued
+        bars.log("first line\n");
+        bars.log("second line");
+        CHECK_EQ(ss.str(), "");
+
+        // And emitted in a single batch on the next update
+        bars.for_one(0, osm::updater{}, 11);
+        std::string out{ss.str()};
+        CHECK_NE(out.find("first line\nsecond line\n"), std::string::npos);
+        CHECK_EQ(out.find(osm::feat(osm::tcsc, "csc", 0)), out.rfind(osm::feat(osm::tcsc, "csc", 0)));
+
+        // The queue is empty after being drawn
+        ss.str("");
+        bars.flush_logs();
+        CHECK_EQ(ss.str(), "");
+
+        osm::cout.rdbuf(old_buffer);
+    }
+
     TEST_SUITE_END();
 }
\ No newline at end of file
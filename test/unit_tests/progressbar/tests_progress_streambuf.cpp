@@ -0,0 +1,106 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/progressbar/progress_streambuf.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+//====================================================
+//     Testing ProgressStreambuf
+//====================================================
+TEST_CASE("Testing the ProgressStreambuf class.") {
+    std::string data;
+    for (int32_t i = 0; i < 10000; i++) data += "line " + std::to_string(i) + "\n";
+
+    SUBCASE("Testing a copy in blocks.") {
+        osm::ProgressBar<int64_t> bar(0, static_cast<int64_t>(data.size()));
+        bar.setStyle("loader", "#");
+        bar.setMessage("copying");
+
+        std::istringstream source(data);
+        std::ostringstream destination;
+        osm::ProgressStreambuf<int64_t> in_buf(source.rdbuf(), &bar);
+        osm::ProgressStreambuf<int64_t> out_buf(destination.rdbuf());
+        in_buf.enableThroughput(true);
+        CHECK_EQ(in_buf.getTarget(), source.rdbuf());
+        CHECK_EQ(in_buf.getProgressBar(), &bar);
+        CHECK_EQ(out_buf.getProgressBar(), nullptr);
+        CHECK(in_buf.isThroughputEnabled());
+
+        std::istream in(&in_buf);
+        std::ostream out(&out_buf);
+        char block[4096];
+        while (in.read(block, sizeof(block)) || in.gcount() > 0) out.write(block, in.gcount());
+        out.flush();
+        osm::cout << std::endl;
+
+        CHECK_EQ(destination.str(), data);
+        CHECK_EQ(in_buf.getBytes(), data.size());
+        CHECK_EQ(out_buf.getBytes(), data.size());
+        CHECK_EQ(bar.getIteratingVar(), 100);
+        CHECK_EQ(bar.getMessage().rfind("copying ", 0), 0);
+        CHECK_NE(bar.getMessage().find("B/s"), std::string::npos);
+        CHECK_GT(in_buf.getThroughput(), 0);
+    }
+
+    SUBCASE("Testing a floating-point ProgressBar.") {
+        osm::ProgressBar<float> bar(0, 100);
+        bar.setStyle("indicator", "%");
+
+        std::stringstream ss;
+        auto old_buffer{osm::cout.rdbuf(ss.rdbuf())};
+        std::istringstream source(data.substr(0, 1000));
+        osm::ProgressStreambuf<float> in_buf(source.rdbuf(), &bar);
+        std::istream in(&in_buf);
+        char block[64];
+        while (in.read(block, sizeof(block)) || in.gcount() > 0) {}
+        osm::cout << std::flush;
+        osm::cout.rdbuf(old_buffer);
+        CHECK_NE(ss.str().find("100"), std::string::npos);
+    }
+
+    SUBCASE("Testing chars, put back and seeks.") {
+        std::istringstream source(data);
+        osm::ProgressStreambuf<int32_t> in_buf(source.rdbuf());
+        std::istream in(&in_buf);
+
+        std::string line;
+        std::getline(in, line);
+        CHECK_EQ(line, "line 0");
+        CHECK_EQ(in_buf.getBytes(), 7);
+
+        CHECK_EQ(in.get(), 'l');
+        in.unget();
+        CHECK_EQ(in_buf.getBytes(), 7);
+        std::getline(in, line);
+        CHECK_EQ(line, "line 1");
+
+        in.seekg(0);
+        std::getline(in, line);
+        CHECK_EQ(line, "line 0");
+        CHECK_EQ(in_buf.getBytes(), 21);
+
+        std::ostringstream destination;
+        osm::ProgressStreambuf<int32_t> out_buf(destination.rdbuf());
+        std::ostream out(&out_buf);
+        out << 'x' << 42 << "end" << std::flush;
+        CHECK_EQ(destination.str(), "x42end");
+        CHECK_EQ(out_buf.getBytes(), 6);
+    }
+}
@@ -0,0 +1,98 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/progressbar/sparkline.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+//====================================================
+//     Testing Sparkline
+//====================================================
+TEST_CASE("Testing the Sparkline class.") {
+    using namespace std::chrono_literals;
+    const auto start = std::chrono::steady_clock::now();
+
+    SUBCASE("Testing width and interval.") {
+        osm::Sparkline sparkline;
+        CHECK_EQ(sparkline.getWidth(), 0);
+        CHECK_EQ(sparkline.getInterval().count(), 250);
+        CHECK(!sparkline.sample(10, start));
+        CHECK_EQ(sparkline.str(), "");
+        CHECK_THROWS_AS(sparkline.setWidth(osm::Sparkline::max_width + 1), std::runtime_error);
+
+        sparkline.setWidth(4);
+        sparkline.setInterval(100ms);
+        CHECK_EQ(sparkline.getInterval().count(), 100);
+        CHECK_EQ(sparkline.str(), "    ");
+    }
+
+    SUBCASE("Testing samples.") {
+        osm::Sparkline sparkline(4, 100ms);
+        CHECK(!sparkline.sample(0, start));
+
+        // Samples closer than the interval are skipped
+        CHECK(!sparkline.sample(5, start + 50ms));
+        CHECK(sparkline.sample(10, start + 100ms));
+        CHECK(sparkline.sample(15, start + 200ms));
+        CHECK_EQ(sparkline.getSamples(), 2);
+        CHECK_EQ(sparkline.str(), "  █▅");
+
+        // A stall is a blank and a slowdown a lower glyph
+        CHECK(sparkline.sample(15, start + 300ms));
+        CHECK(sparkline.sample(20, start + 400ms));
+        CHECK_EQ(sparkline.str(), "█▅ ▅");
+        CHECK(sparkline.sample(80, start + 500ms));
+        CHECK_EQ(sparkline.getSamples(), 4);
+        CHECK_EQ(sparkline.str(), "▂ ▂█");
+
+        // A progress which goes back is a stall
+        CHECK(sparkline.sample(0, start + 600ms));
+        CHECK_EQ(sparkline.str(), " ▂█ ");
+
+        // The intervals without samples are stalls, the last one gets the rate
+        CHECK(sparkline.sample(10, start + 1000ms));
+        CHECK_EQ(sparkline.str(), "   █");
+        CHECK(sparkline.sample(15, start + 1250ms));
+        CHECK_EQ(sparkline.str(), " █ ▃");
+        CHECK(sparkline.sample(15, start + 10s));
+        CHECK_EQ(sparkline.getSamples(), 4);
+        CHECK_EQ(sparkline.str(), "    ");
+
+        sparkline.reset();
+        CHECK_EQ(sparkline.getSamples(), 0);
+        CHECK_EQ(sparkline.str(), "    ");
+    }
+
+    SUBCASE("Testing the sparkline of a ProgressBar.") {
+        osm::ProgressBar<int32_t> bar(0, 50);
+        bar.setStyle("complete", "%", "#");
+        CHECK_EQ(bar.getSparkline().getWidth(), 0);
+        CHECK_THROWS_AS(bar.setSparkline(osm::Sparkline::max_width + 1), std::runtime_error);
+
+        bar.setSparkline(8, 0ms);
+        CHECK_EQ(bar.getSparkline().getWidth(), 8);
+        for (int32_t i = bar.getMin(); i < bar.getMax(); i++) bar.update(i);
+        osm::cout << std::endl;
+        CHECK_GT(bar.getSparkline().getSamples(), 0);
+        CHECK_EQ(bar.getIteratingVar(), 101);
+
+        bar.resetSparkline();
+        CHECK_EQ(bar.getSparkline().getSamples(), 0);
+        bar.resetAll();
+        CHECK_EQ(bar.getSparkline().getWidth(), 0);
+    }
+}
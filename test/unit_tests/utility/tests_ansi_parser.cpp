@@ -0,0 +1,94 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_parser.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+//====================================================
+//     Helpers
+//====================================================
+
+// Handler which logs the events as a string
+struct LogHandler : public osm::AnsiHandler {
+        std::string log;
+
+        void text(std::string_view data) override { log.append("T(").append(data).append(")"); }
+        void control(char ch) override { log.append("C(").append(std::to_string(ch)).append(")"); }
+        void escape(char code) override { log.append("E(").append(1, code).append(")"); }
+        void csi(char code, const int32_t *params, size_t count, char prefix) override {
+            log.append("S(");
+            if (prefix != 0) log.push_back(prefix);
+            for (size_t i = 0; i < count; i++) log.append(i > 0 ? ";" : "").append(std::to_string(params[i]));
+            log.append(1, code).append(")");
+        }
+};
+
+//====================================================
+//     Testing AnsiParser class
+//====================================================
+TEST_CASE("Testing the AnsiParser class.") {
+    osm::AnsiParser parser;
+    LogHandler handler;
+
+    SUBCASE("Testing text and control chars.") {
+        parser.parse("abc\r\ndef\x7Fg", handler);
+        CHECK_EQ(handler.log, "T(abc)C(13)C(10)T(def)T(g)");
+    }
+
+    SUBCASE("Testing CSI sequences.") {
+        parser.parse("\033[1;31mred\033[0m\033[m\033[?25l\033[;5H", handler);
+        CHECK_EQ(handler.log, "S(1;31m)T(red)S(0m)S(m)S(?25l)S(0;5H)");
+    }
+
+    SUBCASE("Testing sequences split across chunks.") {
+        for (char ch: std::string_view("\033[38;5;196mx\033[0m")) parser.parse(std::string_view(&ch, 1), handler);
+        CHECK_EQ(handler.log, "S(38;5;196m)T(x)S(0m)");
+    }
+
+    SUBCASE("Testing skipped sequences.") {
+        parser.parse("\033]0;title\007a\033]8;;url\033\\b\033[ qc\033(Bd\033Pdata\033\\e", handler);
+        CHECK_EQ(handler.log, "T(a)T(b)T(c)T(d)T(e)");
+
+        // CAN aborts a sequence, ESC restarts it
+        handler.log.clear();
+        parser.parse("\033[31\030x\033[3\033[4m", handler);
+        CHECK_EQ(handler.log, "T(x)S(4m)");
+    }
+
+    SUBCASE("Testing escape sequences and controls inside a sequence.") {
+        parser.parse("\033M\033[2\nA", handler);
+        CHECK_EQ(handler.log, "E(M)C(10)S(2A)");
+    }
+
+    SUBCASE("Testing too many and too large parameters.") {
+        std::string sequence = "\033[";
+        for (int i = 0; i < 20; i++) sequence += std::to_string(i) + ";";
+        parser.parse(sequence + "99999999m", handler);
+        CHECK_EQ(handler.log, "S(0;1;2;3;4;5;6;7;8;9;10;11;12;13;14;15m)");
+
+        handler.log.clear();
+        parser.parse("\033[99999999m", handler);
+        CHECK_EQ(handler.log, "S(65535m)");
+    }
+
+    SUBCASE("Testing reset.") {
+        parser.parse("\033[31", handler);
+        parser.reset();
+        parser.parse("m", handler);
+        CHECK_EQ(handler.log, "T(m)");
+    }
+}
@@ -0,0 +1,99 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/asciicast_recorder.hpp>
+#include <osmanip/utility/iostream.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//====================================================
+//     Helper functions
+//====================================================
+
+// read_lines
+std::vector<std::string> read_lines(const std::string &filename) {
+    std::ifstream file(filename, std::ios::binary);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);) lines.push_back(line);
+
+    return lines;
+}
+
+// event_data
+std::string event_data(const std::string &line) {
+    auto start = line.find(", \"o\", \"");
+    if (start == std::string::npos || line.size() < 3) return "";
+
+    start += 8;
+    return line.substr(start, line.size() - 2 - start);
+}
+
+//====================================================
+//     Testing AsciicastRecorder class
+//====================================================
+TEST_CASE("Testing the AsciicastRecorder class.") {
+    const std::string filename{"test_asciicast_recorder.cast"};
+
+    SUBCASE("Testing the header and the events.") {
+        osm::AsciicastRecorder recorder(filename, 100, 30);
+        CHECK_EQ(recorder.getFilename(), filename);
+        CHECK_EQ(recorder.getWidth(), 100);
+        CHECK_EQ(recorder.getHeight(), 30);
+
+        recorder.record("hello \"world\"\n");
+        recorder.record("\033[31mred\\");
+        recorder.record("");
+        CHECK_EQ(recorder.getEvents(), 2);
+        recorder.flush();
+
+        auto lines = read_lines(filename);
+        REQUIRE(lines.size() == 3);
+        CHECK_EQ(lines[0].rfind("{\"version\": 2, \"width\": 100, \"height\": 30, \"timestamp\": ", 0), 0);
+        CHECK_EQ(lines[1].front(), '[');
+        CHECK_EQ(event_data(lines[1]), "hello \\\"world\\\"\\n");
+        CHECK_EQ(event_data(lines[2]), "\\u001b[31mred\\\\");
+
+        // Split UTF-8 characters are joined
+        recorder.record("\xE2\x94");
+        recorder.record("\x80!");
+        recorder.close();
+        recorder.record("ignored");
+
+        lines = read_lines(filename);
+        REQUIRE(lines.size() == 4);
+        CHECK_EQ(event_data(lines[3]), "\xE2\x94\x80!");
+    }
+
+    SUBCASE("Testing osm::cout into a recorder.") {
+        {
+            osm::AsciicastRecorder recorder(filename);
+            CHECK_GT(recorder.getWidth(), 0);
+            osm::cout << std::flush;
+            osm::cout_buf.setRecorder(&recorder);
+            osm::cout << "recorded" << std::flush;
+            osm::cout_buf.setRecorder(nullptr);
+        }
+
+        auto lines = read_lines(filename);
+        REQUIRE(lines.size() == 2);
+        CHECK_EQ(event_data(lines[1]), "recorded");
+    }
+
+    CHECK_THROWS_AS(osm::AsciicastRecorder("missing_dir/test.cast"), std::runtime_error);
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,127 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/flight_recorder.hpp>
+#include <osmanip/utility/iostream.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+//====================================================
+//     Testing FlightRecorder class
+//====================================================
+TEST_CASE("Testing the FlightRecorder class.") {
+    SUBCASE("Testing getters and setters.") {
+        osm::FlightRecorder recorder(100);
+        CHECK_EQ(recorder.getCapacity(), 128);
+        CHECK_EQ(recorder.getRecorded(), 0);
+        CHECK_EQ(recorder.getDumpPath(), "osmanip_flight_recorder.log");
+
+        recorder.setDumpPath("recorder.log");
+        CHECK_EQ(recorder.getDumpPath(), "recorder.log");
+        CHECK_THROWS_AS(recorder.setDumpPath(std::string(5000, 'x')), std::runtime_error);
+
+        CHECK_FALSE(recorder.isDumpOnExitEnabled());
+        recorder.enableDumpOnExit(true);
+        CHECK(recorder.isDumpOnExitEnabled());
+        recorder.enableDumpOnExit(false);
+        CHECK_FALSE(recorder.isDumpOnExitEnabled());
+        recorder.enableDumpOnCrash(true);
+        CHECK(recorder.isDumpOnCrashEnabled());
+        recorder.enableDumpOnCrash(false);
+        CHECK_FALSE(recorder.isDumpOnCrashEnabled());
+    }
+
+    SUBCASE("Testing the ring buffer.") {
+        osm::FlightRecorder recorder(8);
+        recorder.record("abc");
+        CHECK_EQ(recorder.str(), "abc");
+
+        // The oldest bytes are overwritten
+        recorder.record("defghij");
+        CHECK_EQ(recorder.str(), "cdefghij");
+        recorder.record("0123456789");
+        CHECK_EQ(recorder.str(), "23456789");
+        CHECK_EQ(recorder.getRecorded(), 20);
+
+        recorder.clear();
+        CHECK_EQ(recorder.str(), "");
+    }
+
+    SUBCASE("Testing concurrent records.") {
+        osm::FlightRecorder recorder(1 << 16);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([&recorder] {
+                for (int i = 0; i < 1000; i++) recorder.record("0123456789");
+            });
+        }
+        for (auto &thread: threads) thread.join();
+
+        std::string content = recorder.str();
+        CHECK_EQ(content.size(), 40000);
+        for (size_t i = 0; i < content.size(); i += 10) CHECK_EQ(content.substr(i, 10), "0123456789");
+    }
+
+    SUBCASE("Testing dump.") {
+        osm::FlightRecorder recorder(16);
+        recorder.record("hello flight recorder");
+        recorder.setDumpPath("test_flight_recorder.log");
+        REQUIRE(recorder.dump());
+
+        std::ifstream file("test_flight_recorder.log", std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        CHECK_EQ(content.str(), " flight recorder");
+        file.close();
+        std::remove("test_flight_recorder.log");
+
+        CHECK_FALSE(recorder.dump("missing_dir/test_flight_recorder.log"));
+    }
+
+    SUBCASE("Testing osm::cout into a recorder.") {
+        osm::FlightRecorder recorder(1024);
+        osm::cout << std::flush;
+        osm::cout_buf.setRecorder(&recorder);
+        CHECK_EQ(osm::cout_buf.getRecorder(), &recorder);
+
+        osm::cout << "recorded line" << std::endl;
+        osm::cout_buf.setRecorder(nullptr);
+        CHECK_EQ(recorder.str(), "recorded line\n");
+    }
+
+    SUBCASE("Testing osm::cout into a recorder with echo.") {
+        osm::FlightRecorder recorder(1024);
+        std::ostringstream echo;
+        osm::cout << std::flush;
+        osm::cout_buf.setOstream(&echo);
+        osm::cout_buf.setRecorder(&recorder, true);
+
+        // An empty flush must not fail the echo stream
+        osm::cout << "first " << std::flush << std::flush;
+        osm::cout << "second" << std::flush;
+        CHECK(osm::cout.good());
+        CHECK(echo.good());
+        osm::cout_buf.setRecorder(nullptr);
+        osm::cout_buf.setOstream(&std::cout);
+        CHECK_EQ(recorder.str(), "first second");
+        CHECK_EQ(echo.str(), "first second");
+    }
+}
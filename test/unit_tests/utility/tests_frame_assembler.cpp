@@ -0,0 +1,120 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/graphics/canvas.hpp>
+#include <osmanip/utility/flight_recorder.hpp>
+#include <osmanip/utility/frame_assembler.hpp>
+#include <osmanip/utility/iostream.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <iostream>
+#include <sstream>
+#include <string>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+//====================================================
+//     Testing "FrameAssembler" class
+//====================================================
+TEST_CASE("Testing the FrameAssembler class.") {
+    osm::FrameAssembler frame;
+    const std::string large(osm::FrameAssembler::copy_threshold, '#');
+
+    SUBCASE("Testing segments creation.") {
+        CHECK_EQ(frame.size(), 0);
+        CHECK_EQ(frame.getSegments(), 0);
+
+        // Small fragments and numbers are merged together
+        frame.add("\033[31m").addNumber(-42).copy("%");
+        CHECK_EQ(frame.getSegments(), 1);
+        CHECK_EQ(frame.str(), "\033[31m-42%");
+
+        // Large fragments are referenced
+        frame.add(large).add("\n");
+        CHECK_EQ(frame.getSegments(), 3);
+        CHECK_EQ(frame.size(), 9 + large.size() + 1);
+        CHECK_EQ(frame.str(), "\033[31m-42%" + large + "\n");
+
+        frame.clear();
+        CHECK_EQ(frame.size(), 0);
+        CHECK_EQ(frame.str(), "");
+    }
+
+    SUBCASE("Testing append.") {
+        osm::FrameAssembler first, second;
+        first.add("ab").add(large);
+        second.add("cd");
+
+        frame.add("0").append(first).append(second).add("1");
+        CHECK_EQ(frame.getSegments(), 5);
+        CHECK_EQ(frame.size(), 1 + first.size() + second.size() + 1);
+        CHECK_EQ(frame.str(), "0ab" + large + "cd1");
+    }
+
+    SUBCASE("Testing the write methods.") {
+        frame.add("begin ").add(large).addNumber(7);
+
+        std::ostringstream oss;
+        frame.write(oss);
+        CHECK_EQ(oss.str(), frame.str());
+
+#ifndef _WIN32
+        int fds[2];
+        REQUIRE(pipe(fds) == 0);
+        frame.write(fds[1]);
+        close(fds[1]);
+
+        std::string out(frame.size() + 1, '\0');
+        out.resize(static_cast<size_t>(read(fds[0], &out[0], out.size())));
+        close(fds[0]);
+        CHECK_EQ(out, frame.str());
+#endif
+    }
+
+    SUBCASE("Testing the frame writes into osm::cout.") {
+        osm::cout << std::flush;
+        CHECK(std::cout.good());
+        CHECK(osm::is_cout_direct());
+        frame.add("frame ");
+
+        // Recorded or redirected output is written through the streams
+        osm::FlightRecorder recorder(64);
+        osm::cout_buf.setRecorder(&recorder);
+        CHECK(!osm::is_cout_direct());
+        osm::write_frame(frame);
+        osm::cout_buf.setRecorder(nullptr);
+        CHECK_EQ(recorder.str(), "frame ");
+
+        std::ostringstream out;
+        std::streambuf *previous = std::cout.rdbuf(out.rdbuf());
+        CHECK(!osm::is_cout_direct());
+        osm::cout << "text ";
+        osm::write_frame(frame);
+        std::cout.rdbuf(previous);
+        CHECK_EQ(out.str(), "text frame ");
+    }
+
+    SUBCASE("Testing the canvas rendering.") {
+        osm::Canvas canvas(5, 4);
+        canvas.enableFrame(true);
+        canvas.setFrame(osm::FrameStyle::ASCII);
+        canvas.put(2, 1, 'x');
+
+        canvas.render(frame);
+        std::string out{frame.str()};
+        CHECK_EQ(out.substr(0, 1), "+");
+        CHECK_NE(out.find('x'), std::string::npos);
+        CHECK_EQ(out.back(), '\n');
+    }
+}
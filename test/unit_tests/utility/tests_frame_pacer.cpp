@@ -0,0 +1,108 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/graphics/canvas.hpp>
+#include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/utility/frame_pacer.hpp>
+#include <osmanip/utility/iostream.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+//====================================================
+//     Testing "FramePacer" class
+//====================================================
+TEST_CASE("Testing the FramePacer class.") {
+    osm::FramePacer pacer(50, 2);
+
+    SUBCASE("Testing getters, setters and constructor.") {
+        CHECK_EQ(pacer.getMaxFps(), 50);
+        CHECK_EQ(pacer.getMinFps(), 2);
+        CHECK_EQ(pacer.getBytesPerSecond(), 0);
+        CHECK(pacer.getFps() == doctest::Approx(50));
+        CHECK_EQ(pacer.isReducedDetail(), false);
+
+        pacer.setBytesPerSecond(1000);
+        CHECK_EQ(pacer.getBytesPerSecond(), 1000);
+
+        CHECK_THROWS_AS(osm::FramePacer(0, 1), std::runtime_error);
+        CHECK_THROWS_AS(osm::FramePacer(30, -1), std::runtime_error);
+        CHECK_THROWS_AS(pacer.setMaxFps(0), std::runtime_error);
+        CHECK_THROWS_AS(pacer.setMinFps(-2), std::runtime_error);
+        CHECK_EQ(pacer.getMaxFps(), 50);
+        CHECK_EQ(pacer.getMinFps(), 2);
+    }
+
+    SUBCASE("Testing the frame rate adaptation.") {
+        CHECK_EQ(pacer.ready(), true);
+
+        // Fast channel
+        pacer.record(100, std::chrono::microseconds(10));
+        CHECK(pacer.getFps() == doctest::Approx(50));
+        CHECK_EQ(pacer.ready(), false);
+
+        // Slow channel: writes of 100 ms must not take more than a fraction of the time
+        pacer.reset();
+        pacer.record(100, std::chrono::milliseconds(100));
+        CHECK(pacer.getFps() < 10);
+        CHECK(pacer.getFps() >= 2);
+        CHECK_EQ(pacer.isReducedDetail(), true);
+
+        // Byte budget
+        pacer.reset();
+        pacer.setBytesPerSecond(1000);
+        pacer.record(500, std::chrono::microseconds(10));
+        CHECK(pacer.getFps() == doctest::Approx(2));
+    }
+
+    SUBCASE("Testing the canvas refresh skipping.") {
+        osm::Canvas canvas(4, 3);
+        canvas.setFramePacer(&pacer);
+        CHECK_EQ(canvas.getFramePacer(), &pacer);
+
+        std::stringstream ss;
+        auto old_buffer{osm::cout.rdbuf(ss.rdbuf())};
+
+        canvas.refresh();
+        CHECK_NE(ss.str(), "");
+
+        ss.str("");
+        canvas.refresh();
+        CHECK_EQ(ss.str(), "");
+
+        osm::cout.rdbuf(old_buffer);
+    }
+
+    SUBCASE("Testing the progress bar last update.") {
+        osm::FramePacer slow(1, 1);
+        osm::ProgressBar<int32_t> bar(0, 50);
+        bar.setStyle("indicator", "%");
+        bar.setFramePacer(&slow);
+
+        std::stringstream ss;
+        auto old_buffer{osm::cout.rdbuf(ss.rdbuf())};
+
+        // Only the first update and the last one are printed
+        for (int32_t i = bar.getMin(); i < bar.getMax(); i++) bar.update(i);
+        osm::cout << std::flush;
+        osm::cout.rdbuf(old_buffer);
+
+        const std::string output = ss.str();
+        CHECK_NE(output.find("0"), std::string::npos);
+        CHECK_EQ(output.find("50"), std::string::npos);
+        CHECK_NE(output.find("100"), std::string::npos);
+    }
+}
@@ -0,0 +1,124 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/html_converter.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <ios>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+//====================================================
+//     Helpers
+//====================================================
+
+// Convert a string into an HTML fragment
+static std::string to_html(std::string_view input) {
+    std::ostringstream out;
+    osm::HtmlConverter converter(out, false);
+    converter.write(input);
+    converter.finish();
+    return out.str();
+}
+
+// Stream buffer which fails on every write
+struct FailingBuf : public std::streambuf {
+        int_type overflow(int_type) override { throw std::runtime_error("write failed"); }
+};
+
+//====================================================
+//     Testing HtmlConverter class
+//====================================================
+TEST_CASE("Testing the HtmlConverter class.") {
+    SUBCASE("Testing plain text.") {
+        CHECK_EQ(to_html("a < b && c > d"), "a &lt; b &amp;&amp; c &gt; d");
+        CHECK_EQ(to_html("one\r\ntwo\tthree\a\n"), "one\ntwo\tthree\n");
+        CHECK_EQ(to_html("10%\r20%\r"), "10%\n20%\n");
+        CHECK_EQ(to_html("\033[2J\033[Hcleared"), "cleared");
+    }
+
+    SUBCASE("Testing colors and attributes.") {
+        CHECK_EQ(to_html("\033[31mred\033[0m plain"), "<span class=\"osm-fg-1\">red</span> plain");
+        CHECK_EQ(to_html("\033[1;4;92;44mx"), "<span class=\"osm-bold osm-underline osm-fg-10 osm-bg-4\">x</span>");
+        CHECK_EQ(to_html("\033[38;5;196;48;2;1;2;255mx"),
+                 "<span class=\"osm-fg-196\" style=\"background-color: #0102ff;\">x</span>");
+        CHECK_EQ(to_html("\033[7mx\033[27;9my"),
+                 "<span class=\"osm-inverse osm-fg-inverse osm-bg-inverse\">x</span>"
+                 "<span class=\"osm-strike\">y</span>");
+        CHECK_EQ(to_html("\033[1;2mx\033[22my"), "<span class=\"osm-bold osm-dim\">x</span>y");
+    }
+
+    SUBCASE("Testing spans opened only on changes.") {
+        CHECK_EQ(to_html("\033[31ma\033[31mb\033[1m\033[22mc\033[39md"), "<span class=\"osm-fg-1\">abc</span>d");
+        CHECK_EQ(to_html("\033[32m\033[0m"), "");
+    }
+
+    SUBCASE("Testing chunks.") {
+        std::string_view input = "\033[33mye\xc3\xa9llow\r\033[0m&\r\n";
+        std::string expected = to_html(input);
+
+        std::ostringstream out;
+        osm::HtmlConverter converter(out, false);
+        for (char ch: input) converter.write(std::string_view(&ch, 1));
+        converter.finish();
+        CHECK_EQ(out.str(), expected);
+        CHECK_EQ(expected, "<span class=\"osm-fg-3\">ye\xc3\xa9llow\n</span>&amp;\n");
+        CHECK_THROWS_AS(converter.write("x"), std::runtime_error);
+    }
+
+    SUBCASE("Testing convert and the document.") {
+        std::string input;
+        for (int i = 0; i < 20000; i++) {
+            input += "\033[3" + std::to_string(i % 8) + "mline <" + std::to_string(i) + ">\n";
+        }
+
+        std::istringstream in(input);
+        std::ostringstream out;
+        CHECK_EQ(osm::HtmlConverter::convert(in, out), input.size());
+
+        const std::string html = out.str();
+        CHECK_EQ(html.find("<!DOCTYPE html>"), 0);
+        CHECK_NE(html.find(osm::HtmlConverter::stylesheet()), std::string::npos);
+        CHECK_NE(html.find("<span class=\"osm-fg-3\">line &lt;19995&gt;\n</span>"), std::string::npos);
+        CHECK_EQ(html.substr(html.size() - 30), "</span></pre>\n</body>\n</html>\n");
+    }
+
+    SUBCASE("Testing the stylesheet.") {
+        const std::string css = osm::HtmlConverter::stylesheet();
+        CHECK_NE(css.find(".osm-fg-196 { color: #ff0000; }"), std::string::npos);
+        CHECK_NE(css.find(".osm-bg-232 { background-color: #080808; }"), std::string::npos);
+        CHECK_NE(css.find(".osm-bold { font-weight: bold; }"), std::string::npos);
+    }
+
+    SUBCASE("Testing stream errors.") {
+        FailingBuf buf;
+        std::ostream out(&buf);
+        out.exceptions(std::ios::badbit);
+        {
+            osm::HtmlConverter converter(out, false);
+            converter.write("text");
+            CHECK_THROWS(converter.finish());
+        }
+
+        // The destructor doesn't throw, even if the conversion was not finished
+        out.clear();
+        CHECK_NOTHROW({
+            osm::HtmlConverter converter(out, false);
+            converter.write("text");
+        });
+    }
+}
@@ -0,0 +1,40 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/locking.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <mutex>
+#include <type_traits>
+
+//====================================================
+//     Testing locking policy
+//====================================================
+TEST_CASE("Testing the locking policy.") {
+    SUBCASE("Testing the null_mutex class.") {
+        osm::null_mutex mtx;
+        CHECK_EQ(mtx.try_lock(), true);
+        CHECK_EQ(mtx.try_lock(), true);
+        mtx.unlock();
+
+        std::lock_guard<osm::null_mutex> lock{mtx};
+    }
+
+    SUBCASE("Testing the mutex_type alias.") {
+#ifdef OSMANIP_SINGLE_THREADED
+        CHECK(std::is_same_v<osm::mutex_type, osm::null_mutex>);
+#else
+        CHECK(std::is_same_v<osm::mutex_type, std::mutex>);
+#endif
+    }
+}
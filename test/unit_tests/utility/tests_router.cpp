@@ -0,0 +1,156 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/flight_recorder.hpp>
+#include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/router.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+//====================================================
+//     Helpers
+//====================================================
+
+// Sink which counts the chunks written while it is alive and after it is retired
+struct CountingSink : public osm::Recorder {
+        std::atomic<bool> retired{false};
+        std::atomic<uint64_t> chunks{0}, late_chunks{0};
+
+        void record(std::string_view) override { (retired.load() ? late_chunks : chunks).fetch_add(1); }
+};
+
+// Sink which appends the output to a string
+struct StringSink : public osm::Recorder {
+        std::string data;
+
+        void record(std::string_view chunk) override { data += chunk; }
+};
+
+//====================================================
+//     Testing Router class
+//====================================================
+TEST_CASE("Testing the Router class.") {
+    SUBCASE("Testing routes.") {
+        osm::Router router;
+        osm::FlightRecorder first(64), second(64);
+        CHECK_EQ(router.getRoute(1), nullptr);
+        CHECK_THROWS_AS(router.route(osm::Router::max_tags, &first), std::out_of_range);
+
+        // Output without a route is dropped
+        router.record(1, "lost");
+        CHECK_EQ(router.getDropped(), 4);
+
+        router.route(1, &first);
+        router.route(0, &second);
+        CHECK_EQ(router.getRoute(1), &first);
+        router.record(1, "one ");
+        router.record(2, "two ");
+        router.record(1000, "big ");
+        CHECK_EQ(first.str(), "one ");
+        CHECK_EQ(second.str(), "two big ");
+
+        router.route(1, nullptr);
+        router.record(1, "back");
+        CHECK_EQ(second.str(), "two big back");
+        CHECK_EQ(router.getDropped(), 4);
+    }
+
+    SUBCASE("Testing tagged streams and osm::cout.") {
+        osm::Router router;
+        std::ostringstream untagged;
+        osm::OstreamRecorder sink(untagged);
+        std::vector<std::unique_ptr<StringSink>> sinks;
+        router.route(0, &sink);
+        for (uint32_t tag = 1; tag <= 4; tag++) {
+            sinks.push_back(std::make_unique<StringSink>());
+            router.route(tag, sinks.back().get());
+        }
+
+        // Each thread writes its own tag concurrently: no output is routed to another tag
+        std::vector<std::thread> writers;
+        for (uint32_t tag = 1; tag <= 4; tag++) {
+            writers.emplace_back([&router, tag] {
+                osm::TaggedStream stream(router, tag);
+                for (int32_t i = 0; i < 200; i++) stream << tag << ":" << i << std::endl;
+            });
+        }
+        for (auto &writer: writers) writer.join();
+
+        for (uint32_t tag = 1; tag <= 4; tag++) {
+            std::string expected;
+            for (int32_t i = 0; i < 200; i++) expected += std::to_string(tag) + ":" + std::to_string(i) + "\n";
+            CHECK_EQ(sinks[tag - 1]->data, expected);
+        }
+
+        // The output without a tag or without a route goes to tag 0
+        {
+            osm::TaggedStream stream(router, 9);
+            CHECK_EQ(stream.getTag(), 9);
+            stream << "unrouted ";
+        }
+        osm::cout << std::flush;
+        osm::cout_buf.setRecorder(&router);
+        osm::cout << "untagged" << std::endl;
+        osm::cout_buf.setRecorder(nullptr);
+        CHECK_EQ(untagged.str(), "unrouted untagged\n");
+        CHECK_EQ(router.getDropped(), 0);
+    }
+
+    SUBCASE("Testing OstreamRecorder.") {
+        std::ostringstream out;
+        osm::OstreamRecorder sink(out);
+        osm::Router router;
+        router.route(0, &sink);
+        router.record(3, "to the stream");
+        CHECK_EQ(out.str(), "to the stream");
+    }
+
+    SUBCASE("Testing route changes during concurrent writes.") {
+        osm::Router router;
+        CountingSink stable;
+        router.route(1, &stable);
+
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> writers;
+        for (uint32_t t = 0; t < 4; t++) {
+            writers.emplace_back([&router, &stop, t] {
+                while (!stop.load()) router.record(t % 2 == 0 ? 1 : 2, "x");
+            });
+        }
+
+        // Sinks are retired as soon as they are replaced: no write must reach them afterwards
+        uint64_t late_chunks = 0;
+        for (int i = 0; i < 200; i++) {
+            auto sink = std::make_unique<CountingSink>();
+            router.route(2, sink.get());
+            std::this_thread::yield();
+            router.route(2, nullptr);
+            sink->retired.store(true);
+            late_chunks += sink->late_chunks.load();
+        }
+
+        stop.store(true);
+        for (auto &writer: writers) writer.join();
+        CHECK_EQ(late_chunks, 0);
+        CHECK_GT(stable.chunks.load(), 0);
+        CHECK_EQ(stable.late_chunks.load(), 0);
+    }
+}
@@ -23,4 +23,45 @@ TEST_CASE("Testing the strings utilities") {
         CHECK_EQ(osm::find_first_alpha(mixed_string, 11), 18);
         CHECK_EQ(osm::find_first_alpha(mixed_string, 19), 25);
     }
-}
\ No newline at end of file
+
+    SUBCASE("Testing display_width.") {
+        CHECK_EQ(osm::display_width(""), 0);
+        CHECK_EQ(osm::display_width("plain text"), 10);
+        CHECK_EQ(osm::display_width("\033[1;31mred\033[0m"), 3);
+        CHECK_EQ(osm::display_width("\033]8;;https://example.com\033\\link\033]8;;\a"), 4);
+        CHECK_EQ(osm::display_width("tab\tbell\a"), 7);
+        CHECK_EQ(osm::display_width("caf\u00e9 cafe\u0301"), 9);
+        CHECK_EQ(osm::display_width("\u65e5\u672c\u8a9e"), 6);
+        CHECK_EQ(osm::display_width("\U0001F680 \u2588"), 4);
+        CHECK_EQ(osm::display_width("\xff\xe6"), 2);
+    }
+
+    SUBCASE("Testing display_prefix.") {
+        size_t width = 0;
+        CHECK_EQ(osm::display_prefix("abcdef", 4, &width), 4);
+        CHECK_EQ(width, 4);
+        CHECK_EQ(osm::display_prefix("abc", 10, &width), 3);
+        CHECK_EQ(width, 3);
+
+        // Wide chars and escape sequences are never split
+        CHECK_EQ(osm::display_prefix("\u65e5\u672c", 3, &width), 3);
+        CHECK_EQ(width, 2);
+        CHECK_EQ(osm::display_prefix("\033[31mab\033[0mcd", 2, &width), 11);
+        CHECK_EQ(width, 2);
+    }
+}
+
+TEST_CASE("Testing the ANSI formatting utilities") {
+    SUBCASE("Testing omitted CSI numbers.") {
+        CHECK_EQ(osm::get_ansi_csi_number("\033[A"), -1);
+        CHECK_EQ(osm::get_ansi_csi_code("\033[A"), 'A');
+        CHECK_EQ(osm::get_ansi_csi_number("\033[12D"), 12);
+        CHECK_EQ(osm::get_ansi_csi_code("\033[12D"), 'D');
+    }
+
+    SUBCASE("Testing get_formatted_from_ansi.") {
+        CHECK_EQ(osm::get_formatted_from_ansi("10%\r20%\r30%"), "30%");
+        CHECK_EQ(osm::get_formatted_from_ansi("a\nb\033[Ac"), "ac\nb");
+        CHECK_EQ(osm::get_formatted_from_ansi("line\r\n"), "line\n");
+    }
+}
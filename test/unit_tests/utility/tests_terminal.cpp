@@ -0,0 +1,42 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// Platform headers
+#ifndef _WIN32
+#include <signal.h>
+#endif
+
+// My headers
+#include <osmanip/utility/terminal.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <cstdint>
+
+//====================================================
+//     Testing terminal functions
+//====================================================
+TEST_CASE("Testing the terminal functions.") {
+    SUBCASE("Testing terminal_size.") {
+        auto [columns, rows] = osm::terminal_size();
+        CHECK_EQ(columns == 0, rows == 0);
+    }
+
+#ifndef _WIN32
+    SUBCASE("Testing terminal_resize_count.") {
+        uint64_t count = osm::terminal_resize_count();
+        CHECK_EQ(osm::terminal_resize_count(), count);
+
+        raise(SIGWINCH);
+        CHECK_EQ(osm::terminal_resize_count(), count + 1);
+    }
+#endif
+}
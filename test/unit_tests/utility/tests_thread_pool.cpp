@@ -0,0 +1,61 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/thread_pool.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+//====================================================
+//     Testing ThreadPool
+//====================================================
+TEST_CASE("Testing the ThreadPool class.") {
+    osm::ThreadPool pool(4);
+
+    SUBCASE("Testing getThreads.") {
+#ifdef OSMANIP_SINGLE_THREADED
+        CHECK_EQ(pool.getThreads(), 1);
+#else
+        CHECK_EQ(pool.getThreads(), 4);
+#endif
+        CHECK_GE(osm::ThreadPool().getThreads(), 1);
+    }
+
+    SUBCASE("Testing run.") {
+        std::vector<size_t> out(1000, 0);
+        for (int job = 0; job < 3; job++) {
+            pool.run(out.size(), [&](size_t i) { out[i] += i; });
+        }
+        for (size_t i = 0; i < out.size(); i++) CHECK_EQ(out[i], 3 * i);
+
+        std::atomic<int> calls{0};
+        pool.run(0, [&](size_t) { calls++; });
+        CHECK_EQ(calls.load(), 0);
+    }
+
+    SUBCASE("Testing run with exceptions.") {
+        std::atomic<int> calls{0};
+        CHECK_THROWS_AS(pool.run(10,
+                                 [&](size_t i) {
+                                     calls++;
+                                     if (i == 3) throw std::runtime_error("task failed");
+                                 }),
+                        std::runtime_error);
+        CHECK_EQ(calls.load(), 10);
+
+        CHECK_NOTHROW(pool.run(10, [](size_t) {}));
+    }
+}